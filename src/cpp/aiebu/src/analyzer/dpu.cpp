@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iomanip>
+#include <sstream>
+
+#include "dpu.hpp"
+#include "aiebu_error.h"
+
+namespace {
+constexpr unsigned int field_width = 32;
+
+// OP_WRITEBD size depends on row (9 for 0/1 and 7 for rest)
+constexpr uint32_t OP_WRITEBD_SIZE_9 = 9;
+constexpr uint32_t OP_WRITEBD_SIZE_7 = 7;
+
+// Keep in sync with specification/aie2/isa-spec.yaml
+const std::array<aiebu::dpu::op_desc, aiebu::dpu::OP_MAX> dpu_op_table{{
+  {"OP_NOOP", 1},
+  {"OP_WRITEBD", 0},
+  {"OP_WRITE32", 3},
+  {"OP_SYNC", 2},
+  {"OP_WRITEBD_EXTEND_AIETILE", 8},
+  {"OP_WRITE32_EXTEND_GENERAL", 3},
+  {"OP_WRITEBD_EXTEND_SHIMTILE", 10},
+  {"OP_WRITEBD_EXTEND_MEMTILE", 11},
+  {"OP_WRITE32_EXTEND_DIFFBD", 4},
+  {"OP_WRITEBD_EXTEND_SAMEBD_MEMTILE", 9},
+  {"OP_DUMPDDR", 44}, // simulation only, fixed size in the ISA spec
+  {"OP_WRITESHIMBD", 9},
+  {"OP_WRITEMEMBD", 9},
+  {"OP_WRITE32_RTP", 3},
+  {"OP_READ32", 2},
+  {"OP_READ32_POLL", 4},
+  {"OP_RECORD_TIMESTAMP", 1},
+  {"OP_MERGESYNC", 1},
+  {"OP_DUMP_REGISTER", 0},
+}};
+
+inline std::ostream& op_format(std::ostream& strm)
+{
+  strm << std::setw(field_width) << std::left;
+  return strm;
+}
+
+inline std::ostream& dec_format(std::ostream& strm)
+{
+  strm << std::setw(field_width/2) << std::right;
+  return strm;
+}
+}
+
+namespace aiebu {
+
+dpu::
+dpu(const char *buf, uint64_t size)
+  : m_instr(reinterpret_cast<const uint32_t*>(buf)), m_word_size(size/4)
+{
+}
+
+const dpu::op_desc&
+dpu::
+get_op_desc(uint8_t opcode)
+{
+  if (opcode >= OP_MAX)
+    throw error(error::error_code::invalid_asm, "Invalid dpu opcode: " + std::to_string(opcode) + " !!!");
+  return dpu_op_table[opcode];
+}
+
+size_t
+dpu::
+get_op_size(uint8_t opcode, size_t pc) const
+{
+  switch (opcode) {
+  case OP_WRITEBD: {
+    uint8_t row = (m_instr[pc] & 0x0000FF00) >> 8;
+    return (row == 0 || row == 1) ? OP_WRITEBD_SIZE_9 : OP_WRITEBD_SIZE_7;
+  }
+  case OP_DUMP_REGISTER: {
+    if (pc + 1 >= m_word_size)
+      throw error(error::error_code::invalid_asm, "Truncated dpu opcode: OP_DUMP_REGISTER !!!");
+    uint32_t count = m_instr[pc + 1] & 0x00FFFFFF;
+    return 1 + (static_cast<size_t>(count) << 1);
+  }
+  default:
+    return get_op_desc(opcode).words;
+  }
+}
+
+void
+dpu::
+decode(const visitor& visit) const
+{
+  size_t pc = 0;
+  while (pc < m_word_size) {
+    uint8_t opcode = (m_instr[pc] & 0xFF000000) >> 24;
+    size_t size = get_op_size(opcode, pc);
+    if (pc + size > m_word_size)
+      throw error(error::error_code::invalid_asm, std::string("Truncated dpu opcode: ")
+                  + get_op_desc(opcode).mnemonic + " at offset " + std::to_string(pc * 4) + " !!!");
+    visit(instruction{opcode, pc, size, m_instr + pc});
+    pc += size;
+  }
+}
+
+std::string
+dpu::
+get_dpu_summary() const
+{
+  std::array<unsigned int, OP_MAX> op_count = {};
+  std::array<uint64_t, OP_MAX> op_bytes = {};
+  unsigned int total = 0;
+  decode([&](const instruction& inst) {
+    ++op_count[inst.opcode];
+    op_bytes[inst.opcode] += inst.size * 4;
+    ++total;
+  });
+
+  std::stringstream ss;
+  ss << m_word_size * 4 << "B, " << total << "ops" << std::endl;
+  for (uint8_t opcode = 0; opcode < OP_MAX; ++opcode) {
+    if (!op_count[opcode])
+      continue;
+    ss << op_format << dpu_op_table[opcode].mnemonic << dec_format << op_count[opcode]
+       << dec_format << op_bytes[opcode] << "B" << std::endl;
+  }
+  return ss.str();
+}
+
+std::string
+dpu::
+get_all_ops() const
+{
+  std::stringstream ss;
+  decode([&](const instruction& inst) {
+    ss << std::setw(8) << std::setfill('0') << std::right << std::hex << inst.pc * 4 << ": "
+       << std::setfill(' ') << op_format << dpu_op_table[inst.opcode].mnemonic << std::dec
+       << " col " << static_cast<unsigned>(inst.column())
+       << ", row " << static_cast<unsigned>(inst.row()) << std::endl;
+    for (size_t i = 0; i < inst.size; ++i)
+      ss << "    .long 0x" << std::right << std::setw(8) << std::setfill('0') << std::hex << inst.words[i]
+         << std::setfill(' ') << std::dec << std::endl;
+  });
+  return ss.str();
+}
+
+}
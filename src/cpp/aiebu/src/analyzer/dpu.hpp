@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef __AIEBU_DPU_HPP__
+#define __AIEBU_DPU_HPP__
+
+#include <array>
+#include <cinttypes>
+#include <functional>
+#include <string>
+
+namespace aiebu {
+
+// Decoder for aie2 DPU instruction buffers (blob_instr_dpu). The opcode
+// table mirrors specification/aie2/isa-spec.yaml, 'words' there is the
+// total size of the operation in DWORDs and 0 marks variable sized ops.
+// The same walker is used by the preprocessor to locate shim BDs for
+// patching and by the reporter for summaries and disassembly.
+class dpu {
+public:
+  constexpr static uint8_t OP_NOOP = 0x00;
+  constexpr static uint8_t OP_WRITEBD = 0x01;
+  constexpr static uint8_t OP_WRITE32 = 0x02;
+  constexpr static uint8_t OP_SYNC = 0x03;
+  constexpr static uint8_t OP_WRITEBD_EXTEND_AIETILE = 0x04;
+  constexpr static uint8_t OP_WRITE32_EXTEND_GENERAL = 0x05;
+  constexpr static uint8_t OP_WRITEBD_EXTEND_SHIMTILE = 0x06;
+  constexpr static uint8_t OP_WRITEBD_EXTEND_MEMTILE = 0x07;
+  constexpr static uint8_t OP_WRITE32_EXTEND_DIFFBD = 0x08;
+  constexpr static uint8_t OP_WRITEBD_EXTEND_SAMEBD_MEMTILE = 0x09;
+  constexpr static uint8_t OP_DUMPDDR = 0x0a;
+  constexpr static uint8_t OP_WRITESHIMBD = 0x0b;
+  constexpr static uint8_t OP_WRITEMEMBD = 0x0c;
+  constexpr static uint8_t OP_WRITE32_RTP = 0x0d;
+  constexpr static uint8_t OP_READ32 = 0x0e;
+  constexpr static uint8_t OP_READ32_POLL = 0x0f;
+  constexpr static uint8_t OP_RECORD_TIMESTAMP = 0x10;
+  constexpr static uint8_t OP_MERGESYNC = 0x11;
+  constexpr static uint8_t OP_DUMP_REGISTER = 0x12;
+  constexpr static uint8_t OP_MAX = OP_DUMP_REGISTER + 1;
+
+  struct op_desc {
+    const char *mnemonic;
+    uint32_t words;
+  };
+
+  // One decoded operation, 'words' points into the caller's buffer
+  struct instruction {
+    uint8_t opcode;
+    size_t pc;
+    size_t size;
+    const uint32_t *words;
+
+    uint8_t column() const { return (words[0] & 0x00FF0000) >> 16; }
+    uint8_t row() const { return (words[0] & 0x0000FF00) >> 8; }
+  };
+
+  using visitor = std::function<void(const instruction&)>;
+
+  dpu(const char *buf, uint64_t size);
+
+  // Walk the buffer once, calling visit for every operation in order.
+  // Throws on unknown opcodes and on operations running past the end.
+  void decode(const visitor& visit) const;
+
+  [[nodiscard]] std::string get_dpu_summary() const;
+  [[nodiscard]] std::string get_all_ops() const;
+
+  static const op_desc& get_op_desc(uint8_t opcode);
+
+private:
+  const uint32_t *m_instr;
+  size_t m_word_size;
+
+  size_t get_op_size(uint8_t opcode, size_t pc) const;
+};
+
+}
+
+#endif
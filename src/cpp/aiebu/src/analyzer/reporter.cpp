@@ -5,13 +5,17 @@
 #include "aiebu_error.h"
 
 #include "transaction.hpp"
+#include "dpu.hpp"
+#include "packed_reloc.h"
 
+#include <set>
 #include <boost/interprocess/streams/bufferstream.hpp>
 #include <elfio/elfio_dump.hpp>
 
 namespace aiebu {
 
-    reporter::reporter(aiebu::aiebu_assembler::buffer_type /*type*/, const std::vector<char>& elf_data)
+    reporter::reporter(aiebu::aiebu_assembler::buffer_type type, const std::vector<char>& elf_data)
+      : m_type(type)
     {
         boost::interprocess::ibufferstream istr(elf_data.data(), elf_data.size());
         bool result = my_elf_reader.load(istr);
@@ -24,6 +28,31 @@ namespace aiebu {
         ELFIO::dump::header(stream, my_elf_reader );
         ELFIO::dump::section_headers( stream, my_elf_reader);
         ELFIO::dump::segment_headers( stream, my_elf_reader);
+
+        const ELFIO::section* psec = my_elf_reader.sections[".rela.packed"];
+        if (psec) {
+            auto relocs = decode_packed_relocations(psec->get_data(), psec->get_size());
+            stream << "Packed relocations: " << relocs.size() << " entries in "
+                   << psec->get_size() << "B" << std::endl;
+            for (const auto& reloc : relocs)
+                stream << "  offset 0x" << std::hex << reloc.offset << std::dec
+                       << " sym " << reloc.sym_index << " schema " << static_cast<int>(reloc.schema)
+                       << " addend " << reloc.addend << std::endl;
+        }
+
+        // with dedup_sections a duplicate section points at the bytes of the first copy
+        std::set<ELFIO::Elf64_Off> offsets;
+        uint64_t shared = 0;
+        uint64_t saved = 0;
+        for (ELFIO::Elf_Half i = 0; i < my_elf_reader.sections.size(); ++i) {
+            const ELFIO::section* sec = my_elf_reader.sections[i];
+            if (sec->get_type() == ELFIO::SHT_NOBITS || !sec->get_size() || offsets.insert(sec->get_offset()).second)
+                continue;
+            ++shared;
+            saved += sec->get_size();
+        }
+        if (shared)
+            stream << "Shared sections: " << shared << ", " << saved << "B saved" << std::endl;
     }
 
     void reporter::ctrlcode_summary(std::ostream &stream) const
@@ -42,6 +71,13 @@ namespace aiebu {
             stream << "  [" << i << "] " << psec->get_name() << "\t"
                    << psec->get_size() << std::endl;
 
+            // DPU instruction buffers are not transactions, decode them with the dpu isa
+            if (is_dpu()) {
+                dpu dprint(psec->get_data(), psec->get_size());
+                stream << dprint.get_dpu_summary() << std::endl;
+                continue;
+            }
+
             transaction tprint(psec->get_data(), psec->get_size());
             stream << tprint.get_txn_summary() << std::endl;
         }
@@ -68,6 +104,12 @@ namespace aiebu {
             stream << ";  [" << i << "] " << psec->get_name() << "\t"
                    << psec->get_size() << std::endl;
 
+            if (is_dpu()) {
+                dpu dprint(psec->get_data(), psec->get_size());
+                stream << dprint.get_all_ops() << std::endl;
+                continue;
+            }
+
             transaction tprint(psec->get_data(), psec->get_size());
             stream << tprint.get_all_ops() << std::endl;
         }
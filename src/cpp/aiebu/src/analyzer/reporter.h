@@ -12,6 +12,7 @@ namespace aiebu {
 
     class reporter {
     private:
+        aiebu::aiebu_assembler::buffer_type m_type;
         ELFIO::elfio my_elf_reader;
     protected:
         inline bool is_ctrldata(const std::string& name) const
@@ -23,6 +24,11 @@ namespace aiebu {
         {
           return !name.substr(0,8).compare(".ctrlpkt");
         }
+
+        inline bool is_dpu() const
+        {
+          return m_type == aiebu::aiebu_assembler::buffer_type::blob_instr_dpu;
+        }
     public:
         reporter(aiebu::aiebu_assembler::buffer_type type, const std::vector<char>& elf_data);
         void elf_summary(std::ostream &stream) const;
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: MIT
 // Copyright (C) 2024, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <iomanip>
 #include <map>
+#include <sstream>
 #include <string>
 #include "assembler.h"
 #include "aiebu_assembler.h"
@@ -13,9 +15,14 @@
 #include "encoder.h"
 #include "elfwriter.h"
 #include "preprocessor_input.h"
+#include "aie2_blob_elf_updater.h"
 
 #include "reporter.h"
 
+#ifdef AIEBU_FULL
+#include "asm/asm_object.h"
+#endif
+
 namespace aiebu {
 
 aiebu_assembler::
@@ -34,27 +41,39 @@ aiebu_assembler(buffer_type type,
                 const std::vector<char>& patch_json,
                 const std::vector<std::string>& libs,
                 const std::vector<std::string>& libpaths,
-                const std::map<uint8_t, std::vector<char> >& ctrlpkt) : _type(type)
+                const std::map<uint8_t, std::vector<char> >& ctrlpkt)
+                : aiebu_assembler(type, buffer1, buffer2, patch_json, libs, libpaths, ctrlpkt, {})
+{ }
+
+aiebu_assembler::
+aiebu_assembler(buffer_type type,
+                const std::vector<char>& buffer1,
+                const std::vector<char>& buffer2,
+                const std::vector<char>& patch_json,
+                const std::vector<std::string>& libs,
+                const std::vector<std::string>& libpaths,
+                const std::map<uint8_t, std::vector<char> >& ctrlpkt,
+                const std::vector<std::string>& flags) : _type(type)
 {
   if (type == buffer_type::blob_instr_dpu)
   {
-    aiebu::assembler a(assembler::elf_type::aie2_dpu_blob);
+    aiebu::assembler a(assembler::elf_type::aie2_dpu_blob, flags);
     elf_data = a.process(buffer1, libs, libpaths, patch_json, buffer2);
   }
   else if (type == buffer_type::blob_instr_transaction)
   {
-    aiebu::assembler a(assembler::elf_type::aie2_transaction_blob);
+    aiebu::assembler a(assembler::elf_type::aie2_transaction_blob, flags);
     elf_data = a.process(buffer1, libs, libpaths, patch_json, buffer2, ctrlpkt);
   }
   else if (type == buffer_type::asm_aie2)
   {
-    aiebu::assembler a(assembler::elf_type::aie2_asm);
+    aiebu::assembler a(assembler::elf_type::aie2_asm, flags);
     elf_data = a.process(buffer1, libs, libpaths, patch_json, buffer2, ctrlpkt);
   }
 #ifdef AIEBU_FULL
   else if (type == buffer_type::asm_aie2ps)
   {
-    aiebu::assembler a(assembler::elf_type::aie2ps_asm);
+    aiebu::assembler a(assembler::elf_type::aie2ps_asm, flags);
     elf_data = a.process(buffer1, libs, libpaths, patch_json);
   }
 #endif
@@ -63,6 +82,22 @@ aiebu_assembler(buffer_type type,
   }
 }
 
+#ifdef AIEBU_FULL
+aiebu_assembler::
+aiebu_assembler(buffer_type type,
+                const std::vector<std::vector<char>>& units,
+                const std::vector<char>& patch_json,
+                const std::vector<std::string>& libpaths,
+                const std::vector<std::string>& flags) : _type(type)
+{
+  if (type != buffer_type::asm_aie2ps)
+    throw error(error::error_code::invalid_buffer_type, "Buffer_type not supported for linking !!!");
+
+  aiebu::assembler a(assembler::elf_type::aie2ps_asm, flags);
+  elf_data = a.process(link_asm_objects(units, libpaths), {}, libpaths, patch_json);
+}
+#endif
+
 std::vector<char>
 aiebu_assembler::
 get_elf() const
@@ -87,6 +122,72 @@ disassemble(const std::filesystem::path &root) const
     reporter rep(_type, elf_data);
     rep.ctrlcode_detail_summary(root);
 }
+
+std::vector<char>
+aiebu_assembler::
+update_elf(const std::vector<char>& elf,
+           const std::vector<char>& control_packet,
+           const std::vector<char>& patch_json,
+           const std::map<uint8_t, std::vector<char> >& pm_ctrlpkt)
+{
+  aie2_blob_elf_updater updater(elf);
+  return updater.update(control_packet, patch_json, pm_ctrlpkt);
+}
+
+#ifdef AIEBU_FULL
+std::vector<char>
+aiebu_assembler::
+get_object(const std::vector<char>& buffer,
+           const std::vector<std::string>& libpaths)
+{
+  return write_asm_object(buffer, libpaths);
+}
+
+std::vector<char>
+aiebu_assembler::
+link_objects(const std::vector<std::vector<char>>& units,
+             const std::vector<std::string>& libpaths)
+{
+  return link_asm_objects(units, libpaths);
+}
+
+std::vector<page_report>
+aiebu_assembler::
+get_page_report(const std::vector<char>& buffer,
+                const std::vector<std::string>& libpaths,
+                const std::vector<std::string>& flags)
+{
+  aiebu::assembler a(assembler::elf_type::aie2ps_asm, flags);
+  return a.paginate(buffer, libpaths);
+}
+
+void
+aiebu_assembler::
+print_page_report(const std::vector<page_report>& report, std::ostream &stream)
+{
+  static const char* reasons[] = {"size", ".eop", "end"};
+  for (const auto& col : report)
+  {
+    uint64_t used = 0;
+    for (const auto& page : col.pages)
+      used += page.text_bytes + page.data_bytes + page.ooo_table_bytes;
+    // formatted apart to leave the caller's stream flags alone
+    std::ostringstream fill;
+    fill << std::fixed << std::setprecision(1)
+         << (col.pages.empty() ? 0.0 : 100.0 * used / (col.pages.size() * PAGE_SIZE));
+    stream << "col:" << col.column << " pages:" << col.pages.size() << " fill:" << fill.str()
+           << "% estimated page transitions:" << col.page_transitions << "\n";
+    stream << "  page   text   data  align    ooo   tail  jobs  labels  closed\n";
+    for (const auto& page : col.pages)
+    {
+      stream << std::setw(6) << page.index << std::setw(7) << page.text_bytes << std::setw(7) << page.data_bytes
+             << std::setw(7) << page.align_padding << std::setw(7) << page.ooo_table_bytes
+             << std::setw(7) << page.tail_padding << std::setw(6) << page.jobs << std::setw(8) << page.labels
+             << "  " << reasons[static_cast<int>(page.reason)] << "\n";
+    }
+  }
+}
+#endif
 }
 
 DRIVER_DLLESPEC
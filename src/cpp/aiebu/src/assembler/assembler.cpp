@@ -22,19 +22,20 @@
 namespace aiebu {
 
 assembler::
-assembler(const elf_type type)
+assembler(const elf_type type, const std::vector<std::string>& flags)
+  : m_options(flags)
 {
 
   if (type == elf_type::aie2_dpu_blob)  {
     m_preprocessor = std::make_unique<aie2_blob_preprocessor>();
     m_enoder = std::make_unique<aie2_blob_encoder>();
-    m_elfwriter = std::make_unique<aie2_blob_elf_writer>();
+    m_elfwriter = std::make_unique<aie2_blob_elf_writer>(m_options);
     m_ppi = std::make_shared<aie2_blob_dpu_preprocessor_input>();
   }
   else if (type == elf_type::aie2_transaction_blob)  {
     m_preprocessor = std::make_unique<aie2_blob_preprocessor>();
     m_enoder = std::make_unique<aie2_blob_encoder>();
-    m_elfwriter = std::make_unique<aie2_blob_elf_writer>();
+    m_elfwriter = std::make_unique<aie2_blob_elf_writer>(m_options);
     m_ppi = std::make_shared<aie2_blob_transaction_preprocessor_input>();
   }
   else if (type == elf_type::aie2_asm)  {
@@ -42,7 +43,7 @@ assembler(const elf_type type)
     // Reuse encoder and elfwriter flow from the aie2 blob as they do not
     // see the ASM but instead see the same binary aie2 blob.
     m_enoder = std::make_unique<aie2_blob_encoder>();
-    m_elfwriter = std::make_unique<aie2_blob_elf_writer>();
+    m_elfwriter = std::make_unique<aie2_blob_elf_writer>(m_options);
     m_ppi = std::make_shared<aie2_asm_preprocessor_input>();
   }
 #ifdef AIEBU_FULL
@@ -50,13 +51,14 @@ assembler(const elf_type type)
   {
     m_preprocessor = std::make_unique<aie2ps_preprocessor>();
     m_enoder = std::make_unique<aie2ps_encoder>();
-    m_elfwriter = std::make_unique<aie2ps_elf_writer>();
+    m_elfwriter = std::make_unique<aie2ps_elf_writer>(m_options);
     m_ppi = std::make_shared<aie2ps_preprocessor_input>();
   }
 #endif
   else {
     throw error(error::error_code::invalid_buffer_type ,"Invalid elf type!!!");
   }
+  m_ppi->set_options(m_options);
 }
 
 std::vector<char>
@@ -75,4 +77,13 @@ process(const std::vector<char>& buffer1,
   return u;
 }
 
+std::vector<page_report>
+assembler::
+paginate(const std::vector<char>& buffer1,
+         const std::vector<std::string>& libpaths)
+{
+  m_ppi->set_args(buffer1, {}, {}, {}, libpaths, {});
+  return m_preprocessor->process(m_ppi)->get_page_report();
+}
+
 }
@@ -9,6 +9,8 @@
 #include <map>
 
 #include "symbol.h"
+#include "assembler_options.h"
+#include "aiebu_assembler.h"
 
 namespace aiebu {
 
@@ -23,6 +25,7 @@ class assembler
   std::unique_ptr<encoder> m_enoder;
   std::unique_ptr<elf_writer> m_elfwriter;
   std::shared_ptr<preprocessor_input> m_ppi;
+  assembler_options m_options;
 public:
   enum class elf_type
   {
@@ -34,7 +37,7 @@ public:
     aie2_asm
   };
 
-  explicit assembler(const elf_type type);
+  explicit assembler(const elf_type type, const std::vector<std::string>& flags = {});
 
   std::vector<char> process(const std::vector<char>& buffer1,
                             const std::vector<std::string>& libs = {},
@@ -43,6 +46,10 @@ public:
                             const std::vector<char>& buffer2 = {},
                             const std::map<uint8_t, std::vector<char> >& ctrlpkt = {});
 
+  // preprocess only, returns the pagination of each column
+  std::vector<page_report> paginate(const std::vector<char>& buffer1,
+                                    const std::vector<std::string>& libpaths = {});
+
 };
 
 }
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_COMMON_ASSEMBLER_OPTIONS_H_
+#define _AIEBU_COMMON_ASSEMBLER_OPTIONS_H_
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aiebu_error.h"
+#include "utils.h"
+
+namespace aiebu {
+
+// How the aie2ps pager packs the dependency groups of an .eop region into pages
+enum class pagination_mode : uint8_t
+{
+  // in source order, a page is concluded when the next group doesn't fit
+  greedy,
+  // first fit decreasing, largest groups first into the first page with room
+  ffd,
+  // along the expected execution path, launch chains kept on one page
+  exec
+};
+
+// Per assembly options, built from the "flags" passed to aiebu_assembler.
+// Each flag is "<name>" or "<name>=<value>". Everything defaults to the
+// legacy output so ELFs stay byte identical unless a flag is given.
+class assembler_options
+{
+  // emit .rela.packed instead of .rela.dyn
+  bool m_packed_reloc = false;
+  // emit a SysV .hash section for .dynsym
+  bool m_dynsym_hash = false;
+  // ELFCLASS64 output with 64-bit addends and sizes
+  bool m_elf64 = false;
+  // share lexed include files across assemblies in this process
+  bool m_include_cache = false;
+  // reuse paginated and encoded columns whose input is unchanged
+  bool m_incremental = false;
+  // store byte identical sections once, their headers share the file offset
+  bool m_dedup_sections = false;
+  // merge identical data labels of an aie2ps page
+  bool m_dedup_data = false;
+  // page packing of aie2ps columns
+  pagination_mode m_pagination = pagination_mode::greedy;
+  // arg name/index to address, patched at build time instead of by XRT
+  std::map<std::string, uint64_t> m_resolved;
+
+  // "<name>:<address>[;<name>:<address>...]", not ',' separated as
+  // aiebu-asm splits repeated -f values on ','
+  void
+  parse_resolved(const std::string& flag, const std::string& value)
+  {
+    std::string::size_type start = 0;
+    while (start <= value.size()) {
+      auto end = value.find(';', start);
+      if (end == std::string::npos)
+        end = value.size();
+      std::string item = value.substr(start, end - start);
+      auto sep = item.rfind(':');
+      if (sep == std::string::npos || sep == 0 || sep + 1 == item.size())
+        throw error(error::error_code::invalid_flag, "Invalid assembler flag:" + flag + " !!!");
+      try {
+        size_t idx = 0;
+        uint64_t address = std::stoull(item.substr(sep + 1), &idx, 0);
+        if (idx != item.size() - sep - 1)
+          throw std::invalid_argument(item);
+        m_resolved[item.substr(0, sep)] = address;
+      }
+      catch (const std::logic_error&) {
+        throw error(error::error_code::invalid_flag, "Invalid assembler flag:" + flag + " !!!");
+      }
+      start = end + 1;
+    }
+  }
+
+public:
+  assembler_options() = default;
+
+  explicit assembler_options(const std::vector<std::string>& flags)
+  {
+    for (const auto& flag : flags) {
+      auto pos = flag.find('=');
+      std::string name = flag.substr(0, pos);
+      std::string value = (pos == std::string::npos) ? "" : flag.substr(pos + 1);
+
+      if (!name.compare("packed_reloc"))
+        m_packed_reloc = true;
+      else if (!name.compare("dynsym_hash"))
+        m_dynsym_hash = true;
+      else if (!name.compare("elf64"))
+        m_elf64 = true;
+      else if (!name.compare("include_cache"))
+        m_include_cache = true;
+      else if (!name.compare("incremental"))
+        m_incremental = true;
+      else if (!name.compare("dedup_sections"))
+        m_dedup_sections = true;
+      else if (!name.compare("dedup_data"))
+        m_dedup_data = true;
+      else if (!name.compare("resolve"))
+        parse_resolved(flag, value);
+      else if (!name.compare("pagination") && !value.compare("greedy"))
+        m_pagination = pagination_mode::greedy;
+      else if (!name.compare("pagination") && !value.compare("ffd"))
+        m_pagination = pagination_mode::ffd;
+      else if (!name.compare("pagination") && !value.compare("exec"))
+        m_pagination = pagination_mode::exec;
+      else
+        throw error(error::error_code::invalid_flag, "Invalid assembler flag:" + flag + " !!!");
+    }
+  }
+
+  HEADER_ACCESS_GET_SET(bool, packed_reloc);
+  HEADER_ACCESS_GET_SET(bool, dynsym_hash);
+  HEADER_ACCESS_GET_SET(bool, elf64);
+  HEADER_ACCESS_GET_SET(bool, include_cache);
+  HEADER_ACCESS_GET_SET(bool, incremental);
+  HEADER_ACCESS_GET_SET(bool, dedup_sections);
+  HEADER_ACCESS_GET_SET(bool, dedup_data);
+  HEADER_ACCESS_GET_SET(pagination_mode, pagination);
+
+  const std::map<std::string, uint64_t>&
+  get_resolved() const
+  {
+    return m_resolved;
+  }
+};
+
+}
+#endif //_AIEBU_COMMON_ASSEMBLER_OPTIONS_H_
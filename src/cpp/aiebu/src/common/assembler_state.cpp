@@ -4,14 +4,12 @@
 #include "assembler_state.h"
 #include "aiebu_error.h"
 #include "utils.h"
-#include <unordered_map>
-#include <functional>
 
 namespace aiebu {
 
 assembler_state::
 assembler_state(std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> isa,
-                std::vector<std::shared_ptr<asm_data>>& data,
+                std::vector<asm_data*>& data,
                 std::map<std::string, std::shared_ptr<scratchpad_info>>& scratchpad,
                 std::map<std::string, uint32_t>& labelpageindex, uint32_t control_packet_index, bool makeunique)
                 : m_isa(std::move(isa)), m_data(data), m_scratchpad(scratchpad),
@@ -21,6 +19,51 @@ assembler_state(std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>>
   //printstate();
 }
 
+assembler_state::
+assembler_state(std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> isa,
+                std::vector<asm_data*>& text,
+                const std::vector<asm_data*>& data,
+                std::map<std::string, std::shared_ptr<scratchpad_info>>& scratchpad,
+                std::map<std::string, uint32_t>& labelpageindex, uint32_t control_packet_index)
+                : m_isa(std::move(isa)), m_data(text), m_scratchpad(scratchpad),
+                  m_labelpageindex(labelpageindex), m_control_packet_index(control_packet_index)
+{
+  process_page(data);
+}
+
+
+// add a job, a job of the same name is replaced
+jobidx_type
+assembler_state::
+add_job(const jobid_type& jobid, offset_type pos, uint32_t index, uint32_t eopnum, bool isdeferred, bool iseop)
+{
+  auto [it, added] = m_jobindex.emplace(jobid, static_cast<jobidx_type>(m_jobs.size()));
+  if (added)
+    m_jobs.emplace_back(jobid, pos, index, eopnum, isdeferred, iseop);
+  else
+    m_jobs[it->second] = job(jobid, pos, index, eopnum, isdeferred, iseop);
+  return it->second;
+}
+
+labelidx_type
+assembler_state::
+add_label(const asm_data* data, const std::string& name, uint32_t index)
+{
+  auto idx = static_cast<labelidx_type>(m_labels.size());
+  if (!m_labelrefs.emplace(data->get_ref(), idx).second)
+    throw error(error::error_code::invalid_asm, "Label " + name + " present multiple time in asm\n");
+  m_labels.emplace_back(name, m_pos, index);
+  return idx;
+}
+
+jobidx_type
+assembler_state::
+current_job(jobidx_type jobidx, const std::string& name) const
+{
+  if (jobidx == NO_INDEX)
+    throw error(error::error_code::invalid_asm, name + " outside of a job in asm\n");
+  return jobidx;
+}
 
 // makeunique: make the job and label name unique by adding file name with it,
 //             this is only needed before paging as different file can have same
@@ -33,99 +76,163 @@ process(bool makeunique)
   code_section csection = code_section::text;
   uint32_t index = 0;
   uint32_t eopnum = 0;
-  std::string clabelname;
-  jobid_type cjob_id = "";
+  labelidx_type clabel = NO_INDEX;
+  jobidx_type cjob = NO_INDEX;
+  // launched jobs may come later in the asm, they are resolved at the end
+  std::vector<std::pair<jobidx_type, jobid_type>> launches;
   for (auto data : m_data)
   {
 
     if (data->isLabel())
     {
       csection = code_section::data;
-      clabelname = gen_label_name(makeunique, data);
+      std::string labelname = gen_label_name(makeunique, data);
 
       data->set_size(0);
-      if (m_labelmap.find(clabelname) != m_labelmap.end())
-        throw error(error::error_code::invalid_asm, "Label " + clabelname + " present multiple time in asm\n");
-      m_labelmap[clabelname] = std::make_shared<label>(clabelname, m_pos, index);
+      clabel = add_label(data, labelname, index);
     } else if (data->isOpcode()){
       std::string name = data->get_operation()->get_name();
       if (!name.compare("start_job") || !name.compare("start_job_deferred"))
       {
-        clabelname.clear();
-        cjob_id = gen_job_name(makeunique, data);
-        if (m_jobmap.find(cjob_id) != m_jobmap.end())
-          throw error(error::error_code::invalid_asm, "Job " + cjob_id + " present multiple time in asm\n");
-        m_jobmap[cjob_id] = std::make_shared<job>(cjob_id, m_pos, index, eopnum, !name.compare("start_job_deferred"));
-        m_jobids.push_back(cjob_id);
+        clabel = NO_INDEX;
+        jobid_type jobid = gen_job_name(makeunique, data);
+        if (find_job(jobid) != NO_INDEX)
+          throw error(error::error_code::invalid_asm, "Job " + jobid + " present multiple time in asm\n");
+        cjob = add_job(jobid, m_pos, index, eopnum, !name.compare("start_job_deferred"), false);
+        m_jobids.push_back(cjob);
       }
 
       if (!name.compare("eof"))
       {
-        m_jobmap[EOF_ID] = std::make_shared<job>(EOF_ID, m_pos, index, eopnum, false);
-        m_jobids.push_back(EOF_ID);
+        m_eofjob = add_job(EOF_ID, m_pos, index, eopnum, false, false);
+        m_jobids.push_back(m_eofjob);
       }
 
-      if ((*m_isa).count(name) > 0)
+      if (auto isaop = m_isa->find(name); isaop != m_isa->end())
       {
-        offset_type size = (*m_isa)[name]->serializer(data->get_operation()->get_args())->size(*this);
+        offset_type size = isaop->second->size(data->get_operation(), *this);
         m_pos += size;
         data->set_size(size);
         if (!name.compare("eof"))
         {
-          m_jobmap[EOF_ID]->set_end(m_pos);
-          m_jobmap[EOF_ID]->set_end_index(index);
-          cjob_id = -1;
+          m_jobs[m_eofjob].set_end(m_pos);
+          m_jobs[m_eofjob].set_end_index(index);
+          cjob = NO_INDEX;
         }
       } else if (!name.compare(".eop")) {
-        m_jobmap[gen_eop_name(eopnum)] = std::make_shared<job>(gen_eop_name(eopnum), m_pos, index, eopnum, false);
-        m_jobids.push_back(gen_eop_name(eopnum));
+        m_jobids.push_back(add_job(gen_eop_name(eopnum), m_pos, index, eopnum, false, true));
         ++eopnum;
       } else
         throw error(error::error_code::internal_error, "Invalid operation:" + name);
 
       if (!name.compare("local_barrier"))
       {
-        barrierid_type lbid = parse_barrier(data->get_operation()->get_args()[0]);
-        auto it = m_localbarriermap.find(lbid);
-        if (it == m_localbarriermap.end())
-          m_localbarriermap[lbid] = std::vector<jobid_type>();
-        m_jobmap[cjob_id].get()->m_barrierids.push_back(lbid);
-        m_localbarriermap[lbid].push_back(cjob_id);
+        barrierid_type lbid = data->get_operation()->get_operands()[0].to_barrier(data->get_operation()->get_args()[0]);
+        auto [it, added] = m_barrierindex.emplace(lbid, static_cast<barrieridx_type>(m_localbarriers.size()));
+        if (added)
+          m_localbarriers.emplace_back();
+        m_jobs[current_job(cjob, name)].m_barrierids.push_back(it->second);
+        m_localbarriers[it->second].push_back(cjob);
       }
 
       if (!name.compare("launch_job"))
-      {
-        jobid_type launchjobid;
-        launchjobid = gen_job_name(makeunique, data);
-        m_jobmap[cjob_id]->m_dependentjobs.push_back(launchjobid);
-        auto it = m_joblaunchmap.find(launchjobid);
-        if (it == m_joblaunchmap.end())
-          m_joblaunchmap[launchjobid] = std::vector<jobid_type>();
-        m_joblaunchmap[launchjobid].push_back(cjob_id);
-      }
+        launches.emplace_back(current_job(cjob, name), gen_job_name(makeunique, data));
 
       if (!name.compare("end_job"))
       {
-        //TODO : assert if cjob_id not in m_jobmap
-        m_jobmap[cjob_id]->set_end(m_pos);
-        m_jobmap[cjob_id]->set_end_index(index);
-        cjob_id.clear();
+        m_jobs[current_job(cjob, name)].set_end(m_pos);
+        m_jobs[cjob].set_end_index(index);
+        cjob = NO_INDEX;
       }
 
     } else {
       throw error(error::error_code::internal_error, "Unknown type found!!!");
     }
 
-    if (!clabelname.empty() && data->get_operation()->get_name().compare(".align") && data->get_operation()->get_name().compare(".eop"))
+    if (clabel != NO_INDEX && data->get_operation()->get_name().compare(".align") && data->get_operation()->get_name().compare(".eop"))
     {
-      m_labelmap[clabelname]->increment_count(1);
-      m_labelmap[clabelname]->increment_size(data->get_size());
+      m_labels[clabel].increment_count(1);
+      m_labels[clabel].increment_size(data->get_size());
     }
     ++index;
     data->set_section(csection);
   }
 
-  //TODO launch job id sanity check
+  m_joblaunches.resize(m_jobs.size());
+  for (auto& [launcher, jobid] : launches)
+  {
+    auto launched = find_job(jobid);
+    if (launched == NO_INDEX)
+      throw error(error::error_code::invalid_asm, "Job " + jobid + " launched by job "
+                  + m_jobs[launcher].get_jobid() + " not present in asm\n");
+    m_jobs[launcher].m_dependentjobs.push_back(launched);
+    m_joblaunches[launched].push_back(launcher);
+  }
+
+  // references may come before their label, they are resolved at the end,
+  // once, paging and encoding use the result
+  for (auto data : m_data)
+  {
+    if (!data->isOpcode())
+      continue;
+    auto op = data->get_operation();
+    const auto& args = op->get_args();
+    const auto& operands = op->get_operands();
+    for (size_t argi = 0; argi < args.size(); ++argi)
+    {
+      if (!operands[argi].is_ref())
+        continue;
+      if (containscratchpads(std::string(args[argi].substr(1))))
+        op->resolve_ref(argi, true, NO_INDEX);
+      else
+        op->resolve_ref(argi, false, find_label(operands[argi].get_ref()));
+    }
+  }
+}
+
+// Lay out a page, 'm_data' (the page text) followed by 'data'. Jobs keep
+// their names from the asm, on a page they are unique. References keep
+// what the column state resolved them to, labels are found by their
+// interned id.
+void
+assembler_state::
+process_page(const std::vector<asm_data*>& data)
+{
+  uint32_t index = 0;
+  jobidx_type cjob = NO_INDEX;
+  auto layout = [&](const asm_data* token) {
+    if (token->isLabel())
+    {
+      add_label(token, token->get_operation()->get_name(), index);
+    } else {
+      const auto& name = token->get_operation()->get_name();
+      if (!name.compare("start_job") || !name.compare("start_job_deferred"))
+      {
+        jobid_type jobid(token->get_operation()->get_args()[0]);
+        if (find_job(jobid) != NO_INDEX)
+          throw error(error::error_code::invalid_asm, "Job " + jobid + " present multiple time in asm\n");
+        cjob = add_job(jobid, m_pos, index, 0, !name.compare("start_job_deferred"), false);
+      }
+
+      offset_type size = static_cast<offset_type>(token->get_size());
+      if (!name.compare(".align"))
+        size = m_isa->at(name)->size(token->get_operation(), *this);
+      m_pos += size;
+
+      if (!name.compare("end_job") && cjob != NO_INDEX)
+      {
+        m_jobs[cjob].set_end(m_pos);
+        m_jobs[cjob].set_end_index(index);
+        cjob = NO_INDEX;
+      }
+    }
+    ++index;
+  };
+
+  for (const auto& token : m_data)
+    layout(token);
+  for (const auto& token : data)
+    layout(token);
 }
 
 /*
@@ -136,54 +243,31 @@ process(bool makeunique)
  * 3. If string is hex number string (start with "0x"): it return decimal equavalent
  * 4. If string is numeric string: it will convert to decimal
  */
-uint32_t assembler_state::parse_num_arg(const std::string& str) {
-  static const std::unordered_map<std::string, std::function<uint32_t(const std::string&)>> handlers = {
-    {"@", [this](const std::string& s) -> uint32_t {
-          //If string start with '@': it can be either pad name or label name
-          auto key = s.substr(1);
-          if (auto it = m_scratchpad.find(key); it != m_scratchpad.end())
-            return it->second->get_base() + it->second->get_offset();
-          if (auto it = m_labelmap.find(key); it != m_labelmap.end())
-            return it->second->get_pos();
-          throw error(error::error_code::invalid_asm, "Label " + key + " not present in label map\n");
-    }},
-    {"s2mm_", [this](const std::string& s) -> uint32_t { return get_actor("s2mm", s); }},
-    {"mm2s_", [this](const std::string& s) -> uint32_t { return get_actor("mm2s", s); }},
-    {"mem_s2mm_", [this](const std::string& s) -> uint32_t { return get_actor("mem_s2mm", s); }},
-    {"mem_mm2s_", [this](const std::string& s) -> uint32_t { return get_actor("mem_mm2s", s); }},
-    {"shim_s2mm_", [this](const std::string& s) -> uint32_t { return get_actor("shim_s2mm", s); }},
-    {"shim_mm2s_", [this](const std::string& s) -> uint32_t { return get_actor("shim_mm2s", s); }},
-    {"tile_s2mm_", [this](const std::string& s) -> uint32_t { return get_actor("tile_s2mm", s); }},
-    {"tile_mm2s_", [this](const std::string& s) -> uint32_t { return get_actor("tile_mm2s", s); }}
-  };
+uint32_t assembler_state::parse_num_arg(std::string_view str) {
+  return parse_num_arg(str, operand::parse(str));
+}
 
-  // check if its pad/label/actor
-  for (const auto& [prefix, handler] : handlers) {
-    if (str.rfind(prefix) == 0) {
-      return handler(str);
-    }
+uint32_t assembler_state::parse_num_arg(std::string_view str, const operand& op) {
+  switch (op.get_kind()) {
+  case operand::kind::ref: {
+    //If string start with '@': it can be either pad name or label name
+    std::string key(str.substr(1));
+    if (op.is_pad())
+      return m_scratchpad.at(key)->get_base() + m_scratchpad.at(key)->get_offset();
+    if (auto idx = find_label(op.get_ref()); idx != NO_INDEX)
+      return m_labels[idx].get_pos();
+    throw error(error::error_code::invalid_asm, "Label " + key + " not present in label map\n");
   }
-
-  if (str.rfind("tile_") == 0)
-  {
-    // Parse and return perticular col and row 32bit base address eg: tile_0_1
-    constexpr static size_t col_start = 5;
-    constexpr static size_t len_of_underscore = 1;
-    constexpr static size_t row_mask = 0x1F;
-    constexpr static size_t col_mask = 0x7F;
-    constexpr static size_t col_shift = 5;
-    size_t row_start = col_start + len_of_underscore + str.substr(col_start).rfind("_");
-    uint32_t col = std::stoi(str.substr(col_start));
-    uint32_t row = std::stoi(str.substr(row_start));
-    return (((col & col_mask) << col_shift) | (row & row_mask));
-  } else if (str.rfind("0x") == 0)
-  { //parse hex string
-    return std::stoul(str.substr(2), nullptr , HEX_BASE);
-  } else if (is_number(str))
-  { //parse numeric string
-    return std::stoul(str);
-  } else
+  case operand::kind::immediate:
+  case operand::kind::actor:
+  case operand::kind::tile:
+    return op.get_value();
+  case operand::kind::text:
+    // malformed number, parse again to report it
+    return parse_num_arg(str);
+  default:
     throw symbol_exception();
+  }
 }
 
 void
@@ -192,33 +276,35 @@ printstate() const
 {
   //print state object
   //JOBS
-  for (auto &it : m_jobmap)
+  for (jobidx_type i = 0; i < m_jobs.size(); ++i)
   {
-    std::cout << "JOB[" << it.first << "] =>\tm_jobid:" << it.second->get_jobid()
-              << "  m_start:" << it.second->get_start() << "  m_end:"
-              << it.second->get_end() << "  m_start_index:" << it.second->get_start_index()
-              << "  m_end_index:" << it.second->get_end_index() << "  m_eopnum:"
-              << it.second->get_eopnum() << '\n';
+    const auto& j = m_jobs[i];
+    std::cout << "JOB[" << i << "] =>\tm_jobid:" << j.get_jobid()
+              << "  m_start:" << j.get_start() << "  m_end:"
+              << j.get_end() << "  m_start_index:" << j.get_start_index()
+              << "  m_end_index:" << j.get_end_index() << "  m_eopnum:"
+              << j.get_eopnum() << '\n';
   }
   std::cout<<"\n";
 
   //LOCAL BARRIERS
-  for (auto it : m_localbarriermap)
+  for (const auto& [lbid, idx] : m_barrierindex)
   {
-    std::cout << "LBMAP[" << it.first << "] =>\t";
-    for( auto v : it.second)
-      std::cout << v << ", ";
+    std::cout << "LBMAP[" << lbid << "] =>\t";
+    for (auto v : m_localbarriers[idx])
+      std::cout << m_jobs[v].get_jobid() << ", ";
     std::cout<<"\n";
   }
   std::cout<<"\n";
 
   //LABELS
-  for (auto it : m_labelmap)
+  for (labelidx_type i = 0; i < m_labels.size(); ++i)
   {
-    std::cout << "LABELS[" << it.first << "] =>\tm_name:" << it.second->get_name()
-              << "  m_pos:" << it.second->get_pos() << "  m_index:"
-              << it.second->get_index() << "  m_count:" << it.second->get_count()
-              << "  m_size:" << it.second->get_size() << '\n';
+    const auto& l = m_labels[i];
+    std::cout << "LABELS[" << i << "] =>\tm_name:" << l.get_name()
+              << "  m_pos:" << l.get_pos() << "  m_index:"
+              << l.get_index() << "  m_count:" << l.get_count()
+              << "  m_size:" << l.get_size() << '\n';
   }
   std::cout<<"\n";
 }
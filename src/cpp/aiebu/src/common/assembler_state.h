@@ -12,6 +12,7 @@
 #include <iostream>
 #include <memory>
 #include <map>
+#include <unordered_map>
 
 namespace aiebu {
 
@@ -22,6 +23,13 @@ class symbol_exception : public std::exception
 
 };
 
+// Dense ids of the jobs, labels and local barriers of one assembler_state,
+// numbered in order of appearance in the asm
+using jobidx_type = uint32_t;
+using labelidx_type = uint32_t;
+using barrieridx_type = uint32_t;
+constexpr uint32_t NO_INDEX = -1;
+
 class job
 {
   jobid_type m_jobid;
@@ -32,14 +40,15 @@ class job
   pageid_type m_pagenum;
   bool m_isdeferred;
   uint32_t m_eopnum;
+  bool m_iseop;
 
 public:
-  std::vector<barrierid_type> m_barrierids;
-  std::vector<jobid_type> m_dependentjobs;
+  std::vector<barrieridx_type> m_barrierids;
+  std::vector<jobidx_type> m_dependentjobs;
 
-  job(jobid_type jobid, offset_type pos, uint32_t index, uint32_t eopnum, bool isdeferred)
+  job(jobid_type jobid, offset_type pos, uint32_t index, uint32_t eopnum, bool isdeferred, bool iseop = false)
   :m_jobid(jobid), m_start(pos), m_end(pos), m_start_index(index), m_end_index(index),
-   m_pagenum(NO_PAGE), m_isdeferred(isdeferred), m_eopnum(eopnum) {}
+   m_pagenum(NO_PAGE), m_isdeferred(isdeferred), m_eopnum(eopnum), m_iseop(iseop) {}
 
   job(job* j)
   {
@@ -51,6 +60,7 @@ public:
     j->m_pagenum = m_pagenum;
     j->m_isdeferred = m_isdeferred;
     j->m_eopnum = m_eopnum;
+    j->m_iseop = m_iseop;
   }
 
   HEADER_ACCESS_GET_SET(jobid_type, jobid);
@@ -60,6 +70,7 @@ public:
   HEADER_ACCESS_GET_SET(offset_type, end);
   HEADER_ACCESS_GET_SET(uint32_t, start_index);
   HEADER_ACCESS_GET_SET(uint32_t, end_index);
+  bool is_eop() const { return m_iseop; }
   offset_type get_size()
   {
     return m_end - m_start;
@@ -77,7 +88,7 @@ class label
 
 public:
 
-  label(std::string& name, offset_type pos, uint32_t index):m_name(name), m_pos(pos), m_index(index) {}
+  label(const std::string& name, offset_type pos, uint32_t index):m_name(name), m_pos(pos), m_index(index), m_pagenum(NO_PAGE) {}
   label(label *t)
   {
     t->m_name = m_name;
@@ -91,7 +102,7 @@ public:
   HEADER_ACCESS_GET_SET(int32_t, count);
   HEADER_ACCESS_GET_SET(uint32_t, index);
   HEADER_ACCESS_GET_SET(offset_type, pos);
-  const std::string& get_name() { return m_name; }
+  const std::string& get_name() const { return m_name; }
   void increment_size(uint64_t size)
   {
     m_size += size;
@@ -106,14 +117,29 @@ public:
 class assembler_state
 {
   offset_type m_pos = 0;
-  inline std::string gen_label_name(bool makeunique, const std::shared_ptr<asm_data> data)
+  // names of jobs and barriers to their ids, only used while the state is
+  // built and to resolve names coming from the asm
+  std::unordered_map<jobid_type, jobidx_type> m_jobindex;
+  std::unordered_map<barrierid_type, barrieridx_type> m_barrierindex;
+  // interned label to its id, references are resolved with it once, see
+  // operand::get_label(). Label names are kept for diagnostics only.
+  std::unordered_map<refid_type, labelidx_type> m_labelrefs;
+
+  labelidx_type add_label(const asm_data* data, const std::string& name, uint32_t index);
+
+  jobidx_type add_job(const jobid_type& jobid, offset_type pos, uint32_t index, uint32_t eopnum,
+                      bool isdeferred, bool iseop);
+  jobidx_type current_job(jobidx_type jobidx, const std::string& name) const;
+
+  inline std::string gen_label_name(bool makeunique, const asm_data* data)
   {
     return makeunique ? data->get_file() + ":" + data->get_operation()->get_name() : data->get_operation()->get_name();
   }
 
-  inline std::string gen_job_name(bool makeunique, const std::shared_ptr<asm_data> data)
+  inline std::string gen_job_name(bool makeunique, const asm_data* data)
   {
-    return makeunique ? data->get_file() + ":" + data->get_operation()->get_args()[0] : data->get_operation()->get_args()[0];
+    std::string jobid(data->get_operation()->get_args()[0]);
+    return makeunique ? data->get_file() + ":" + jobid : jobid;
   }
 
   inline std::string gen_eop_name(uint32_t eopnum)
@@ -121,46 +147,40 @@ class assembler_state
     return EOP_ID + std::to_string(eopnum);
   }
 
-  struct ActionId {
-    uint32_t actor_start; //offset in string
-    uint32_t base_actor_offset; //base channel
-  };
-
-  const std::unordered_map<std::string, ActionId> actor_id = {
-    {"mm2s", {5, 6}},
-    {"s2mm", {5, 0}},
-    {"tile_mm2s", {10, 6}},
-    {"tile_s2mm", {10, 0}},
-    {"shim_mm2s", {10, 6}},
-    {"shim_s2mm", {10, 0}},
-    {"mem_mm2s", {9, 6}},
-    {"mem_s2mm", {9, 0}}
-  };
-
-  uint32_t get_actor(const std::string& prefix, const std::string& s) const
-  {
-    uint32_t actor = std::stoi(s.substr(actor_id.at(prefix).actor_start));
-    return actor_id.at(prefix).base_actor_offset + actor;
-  }
 public:
   std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> m_isa;
-  std::vector<std::shared_ptr<asm_data>>& m_data;
-  std::vector<jobid_type> m_jobids;
-  std::map<jobid_type, std::shared_ptr<job>> m_jobmap;
-  std::map<std::string, std::shared_ptr<label>> m_labelmap;
-  std::map<barrierid_type, std::vector<jobid_type>> m_localbarriermap;
-  std::map<jobid_type, std::vector<jobid_type>> m_joblaunchmap;
+  std::vector<asm_data*>& m_data;
+  // jobs in asm order, the eof job once per eof
+  std::vector<jobidx_type> m_jobids;
+  std::vector<job> m_jobs;
+  std::vector<label> m_labels;
+  // barrier to the jobs using it, in order of use
+  std::vector<std::vector<jobidx_type>> m_localbarriers;
+  // job to the jobs launching it
+  std::vector<std::vector<jobidx_type>> m_joblaunches;
+  jobidx_type m_eofjob = NO_INDEX;
   std::map<std::string, std::shared_ptr<scratchpad_info>>& m_scratchpad;
-  std::map<std::string, std::vector<std::string>> m_patch;
+  // pad reference to the operands naming the tables APPLY_OFFSET_57 patches with it
+  std::map<std::string, std::vector<std::pair<std::string_view, operand>>> m_patch;
   std::map<std::string, uint32_t>& m_labelpageindex;
   uint32_t m_control_packet_index;
   std::string m_controlpacket_padname;
 
   assembler_state(std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> isa,
-                  std::vector<std::shared_ptr<asm_data>>& data,
+                  std::vector<asm_data*>& data,
                   std::map<std::string, std::shared_ptr<scratchpad_info>>& scratchpad,
                   std::map<std::string, uint32_t>& labelpageindex, uint32_t control_packet_index, bool makeunique);
 
+  // View of one page of a paginated column: 'text' and 'data' are the page
+  // sections. The tokens were sized by the state the column was paginated
+  // with, only positions are redone, relative to the page, and only .align
+  // whose size depends on them is sized again.
+  assembler_state(std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> isa,
+                  std::vector<asm_data*>& text,
+                  const std::vector<asm_data*>& data,
+                  std::map<std::string, std::shared_ptr<scratchpad_info>>& scratchpad,
+                  std::map<std::string, uint32_t>& labelpageindex, uint32_t control_packet_index);
+
   HEADER_ACCESS_GET_SET(offset_type, pos);
 
   void printstate() const;
@@ -174,31 +194,26 @@ public:
     return (m_scratchpad.find(label) != m_scratchpad.end());
   }
 
-  uint32_t parse_num_arg(const std::string& str);
+  uint32_t parse_num_arg(std::string_view str);
+
+  // 'str' is the operand text, 'op' the operand decoded from it at parse time
+  uint32_t parse_num_arg(std::string_view str, const operand& op);
 
   void process(bool makeunique);
 
-  const std::vector<jobid_type> get_job_list() const
+  void process_page(const std::vector<asm_data*>& data);
+
+  // NO_INDEX if there is no such job/label
+  jobidx_type find_job(const jobid_type& jobid) const
   {
-    // get list of jobs
-    std::vector<jobid_type> keys;
-    std::transform(
-      m_jobmap.begin(),
-      m_jobmap.end(),
-      std::back_inserter(keys),
-      [](const std::map<jobid_type, std::shared_ptr<job>>::value_type &pair){return pair.first;});
-    return keys;
+    auto it = m_jobindex.find(jobid);
+    return (it == m_jobindex.end()) ? NO_INDEX : it->second;
   }
-  const std::vector<std::string> get_label_list() const
+
+  labelidx_type find_label(refid_type ref) const
   {
-    // get list of jobs
-    std::vector<std::string> keys;
-    std::transform(
-      m_labelmap.begin(),
-      m_labelmap.end(),
-      std::back_inserter(keys),
-      [](const std::map<std::string, std::shared_ptr<label>>::value_type &pair){return pair.first;});
-    return keys;
+    auto it = m_labelrefs.find(ref);
+    return (it == m_labelrefs.end()) ? NO_INDEX : it->second;
   }
 };
 
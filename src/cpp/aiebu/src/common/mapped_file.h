@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_COMMON_MAPPED_FILE_H_
+#define _AIEBU_COMMON_MAPPED_FILE_H_
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aiebu {
+
+// Read only view of a whole file. The file is mapped where mmap is
+// available so callers can parse it in place, on Windows it is read into
+// memory once. The view stays valid as long as the object is alive.
+class mapped_file
+{
+  const char* m_data = nullptr;
+  size_t m_size = 0;
+#if defined(_WIN32)
+  std::vector<char> m_buffer;
+#else
+  void* m_map = nullptr;
+#endif
+
+  mapped_file() = default;
+
+public:
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  ~mapped_file()
+  {
+#if !defined(_WIN32)
+    if (m_map)
+      munmap(m_map, m_size);
+#endif
+  }
+
+  // returns nullptr if the file can not be opened
+  static std::shared_ptr<mapped_file>
+  open(const std::string& filename)
+  {
+    std::shared_ptr<mapped_file> file(new mapped_file());
+#if defined(_WIN32)
+    std::ifstream input(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!input.is_open())
+      return nullptr;
+    file->m_buffer.resize(static_cast<size_t>(input.tellg()));
+    input.seekg(0);
+    input.read(file->m_buffer.data(), file->m_buffer.size());
+    file->m_data = file->m_buffer.data();
+    file->m_size = file->m_buffer.size();
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return nullptr;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+      close(fd);
+      return nullptr;
+    }
+    // mmap of a zero length file fails, an empty view is all we need
+    if (st.st_size > 0) {
+      void* map = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+      }
+      file->m_map = map;
+      file->m_data = static_cast<const char*>(map);
+      file->m_size = static_cast<size_t>(st.st_size);
+    }
+    close(fd);
+#endif
+    return file;
+  }
+
+  const char* data() const { return m_data; }
+  size_t size() const { return m_size; }
+  std::string_view view() const { return std::string_view(m_data, m_size); }
+};
+
+}
+#endif //_AIEBU_COMMON_MAPPED_FILE_H_
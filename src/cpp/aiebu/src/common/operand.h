@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_COMMON_OPERAND_H_
+#define _AIEBU_COMMON_OPERAND_H_
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "utils.h"
+
+namespace aiebu {
+
+// id of a "<file>:<name>" label or reference, see asm_arena::intern_ref()
+using refid_type = uint32_t;
+constexpr refid_type NO_REF = static_cast<refid_type>(-1);
+
+// Operand of an asm operation, classified once when the operation is built
+// so sizing, paging and encoding do not re-parse the text in every pass.
+// The text itself stays in operation::get_args(), an operand only carries
+// what was decoded from it. A reference carries the id its "<file>:<name>"
+// is interned as, see asm_arena::intern_ref(), and what that resolved to in
+// the assembler_state of its column, see assembler_state::process().
+//
+// Operands are decoded without knowing the isa argument type, so the typed
+// accessors fall back to the string parsers whenever the syntax does not
+// match. That keeps values and diagnostics identical to parsing the text.
+class operand
+{
+public:
+  enum class kind : uint8_t
+  {
+    text = 0,      // could not be decoded, parse again on use to report the error
+    immediate = 1, // "123" or "0x7b"
+    reg = 2,       // "$r<n>" or "$g<n>"
+    barrier = 3,   // "$lb<n>" or "$rb<n>"
+    ref = 4,       // "@<name>", a pad or a label, resolved by assembler_state
+    actor = 5,     // "s2mm_<n>", "mem_mm2s_<n>" ...
+    tile = 6,      // "tile_<col>_<row>"
+    symbol = 7,    // anything else, patched through a symbol
+  };
+
+  // label index of a reference to no label
+  constexpr static uint32_t NO_LABEL = static_cast<uint32_t>(-1);
+
+private:
+  kind m_kind = kind::text;
+  bool m_pad = false;
+  uint32_t m_value = 0;
+  uint32_t m_label = NO_LABEL;
+
+  operand(kind k, uint32_t value): m_kind(k), m_value(value) {}
+
+  struct actor_prefix
+  {
+    std::string_view prefix;
+    uint32_t base_actor_offset; //base channel
+  };
+
+  static bool starts_with(std::string_view str, std::string_view prefix)
+  {
+    return str.size() >= prefix.size() && !str.compare(0, prefix.size(), prefix);
+  }
+
+  static bool is_number(std::string_view s)
+  {
+    return !s.empty() && std::all_of(s.begin(), s.end(), ::isdigit);
+  }
+
+public:
+  operand() = default;
+
+  HEADER_ACCESS_GET(kind, kind);
+  HEADER_ACCESS_GET(uint32_t, value);
+
+  // Decode 'str', throws the same std::stoi/std::stoul exceptions as
+  // assembler_state::parse_num_arg() did for malformed numbers
+  static operand parse(std::string_view str)
+  {
+    static constexpr std::array<actor_prefix, 8> actors = {{
+      {"s2mm_", 0},
+      {"mm2s_", 6},
+      {"mem_s2mm_", 0},
+      {"mem_mm2s_", 6},
+      {"shim_s2mm_", 0},
+      {"shim_mm2s_", 6},
+      {"tile_s2mm_", 0},
+      {"tile_mm2s_", 6},
+    }};
+
+    if (starts_with(str, "@"))
+      return operand(kind::ref, NO_REF);
+
+    for (const auto& actor : actors)
+      if (starts_with(str, actor.prefix))
+        return operand(kind::actor, actor.base_actor_offset + std::stoi(std::string(str.substr(actor.prefix.size()))));
+
+    if (starts_with(str, "tile_"))
+    {
+      // col and row 32bit base address eg: tile_0_1
+      constexpr static size_t col_start = 5;
+      constexpr static size_t len_of_underscore = 1;
+      constexpr static size_t row_mask = 0x1F;
+      constexpr static size_t col_mask = 0x7F;
+      constexpr static size_t col_shift = 5;
+      size_t row_start = col_start + len_of_underscore + str.substr(col_start).rfind("_");
+      uint32_t col = std::stoi(std::string(str.substr(col_start)));
+      uint32_t row = std::stoi(std::string(str.substr(row_start)));
+      return operand(kind::tile, ((col & col_mask) << col_shift) | (row & row_mask));
+    }
+
+    if (starts_with(str, "0x"))
+      return operand(kind::immediate, std::stoul(std::string(str.substr(2)), nullptr, HEX_BASE));
+
+    if (is_number(str))
+      return operand(kind::immediate, std::stoul(std::string(str)));
+
+    // registers and barriers are only numbers to their own argument types,
+    // an out of range one is left to parse_register()/parse_barrier()
+    try {
+      if (starts_with(str, "$r") || starts_with(str, "$g"))
+        return operand(kind::reg, parse_register(std::string(str)));
+      if (starts_with(str, "$lb") || starts_with(str, "$rb"))
+        return operand(kind::barrier, parse_barrier(std::string(str)));
+    } catch (const std::exception&) {
+    }
+    return operand(kind::symbol, 0);
+  }
+
+  // Same as parse() but never throws, malformed numbers become kind::text
+  static operand classify(std::string_view str)
+  {
+    try {
+      return parse(str);
+    } catch (const std::logic_error&) {
+      return operand();
+    }
+  }
+
+  bool is_ref() const { return m_kind == kind::ref; }
+
+  // interned id of a reference, see asm_arena::intern_ref()
+  void set_ref(refid_type id) { m_value = id; }
+  refid_type get_ref() const { return m_value; }
+
+  // a reference names a pad or the label with index 'label'
+  void resolve(bool pad, uint32_t label)
+  {
+    m_pad = pad;
+    m_label = label;
+  }
+  bool is_pad() const { return m_pad; }
+  uint32_t get_label() const { return m_label; }
+
+  // value for a REG argument, 'str' is the operand text
+  uint32_t to_register(std::string_view str) const
+  {
+    return (m_kind == kind::reg) ? m_value : parse_register(std::string(str));
+  }
+
+  // value for a BARRIER argument, 'str' is the operand text
+  uint32_t to_barrier(std::string_view str) const
+  {
+    return (m_kind == kind::barrier) ? m_value : parse_barrier(std::string(str));
+  }
+};
+
+}
+#endif //_AIEBU_COMMON_OPERAND_H_
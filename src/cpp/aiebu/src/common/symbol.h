@@ -31,7 +31,7 @@ private:
   offset_type m_pos;
   uint32_t m_colnum;
   uint32_t m_pagenum;
-  uint32_t m_addend;
+  uint64_t m_addend;
   // size is overloaded
   // for scaler_32, it contaim mask
   // for shim_dma_48, it contain size of dma
@@ -41,7 +41,7 @@ private:
 
 public:
 
-  symbol(const std::string& name, uint32_t pos, uint32_t colnum, uint32_t pagenum, uint32_t addend,
+  symbol(const std::string& name, uint32_t pos, uint32_t colnum, uint32_t pagenum, uint64_t addend,
          uint64_t size, const std::string& section_name,
          patch_schema schema=patch_schema::unknown)
          :m_name(name), m_schema(schema), m_pos(pos), m_colnum(colnum),
@@ -58,7 +58,7 @@ public:
 
   HEADER_ACCESS_GET_SET(patch_schema, schema);
   HEADER_ACCESS_GET_SET(offset_type, pos);
-  HEADER_ACCESS_GET_SET(uint32_t, addend);
+  HEADER_ACCESS_GET_SET(uint64_t, addend);
   HEADER_ACCESS_GET_SET(std::string, section_name);
   HEADER_ACCESS_GET_SET(ELFIO::Elf_Word, index);
   HEADER_ACCESS_GET_SET(uint64_t, size);
@@ -29,6 +29,10 @@ constexpr pageid_type NO_PAGE = -1;
 const static jobid_type EOF_ID("EOF");
 const static jobid_type EOP_ID("EOP");
 constexpr offset_type PAGE_SIZE = 8192;
+// out of order page lengths the page header has room for, pages with more
+// targets carry a table of {u16 page index, u16 page length} entries
+constexpr uint32_t OOO_HEADER_SLOTS = 2;
+constexpr offset_type OOO_TABLE_ENTRY_SIZE = 4;
 constexpr int HEX_BASE = 16;
 constexpr int WORD_SIZE = 4;
 
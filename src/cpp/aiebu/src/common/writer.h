@@ -53,6 +53,11 @@ public:
     return m_type;
   }
 
+  void reserve(offset_type size)
+  {
+    m_data.reserve(size);
+  }
+
   void set_data(std::vector<uint8_t> &data)
   {
     m_data = std::move(data);
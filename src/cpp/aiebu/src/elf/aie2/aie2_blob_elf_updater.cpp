@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <set>
+#include <boost/format.hpp>
+#include <boost/interprocess/streams/bufferstream.hpp>
+
+#include "aie2_blob_elf_updater.h"
+#include "aie2_blob_elfwriter.h"
+#include "aie2_blob_preprocessor_input.h"
+#include "packed_reloc.h"
+
+namespace aiebu {
+
+namespace {
+
+const std::string ctrldata = ".ctrldata";
+const std::string control_packet_arg = "control-packet";
+// kernel args start at 3, see aie2_blob_preprocessor_input::ARG_OFFSET
+constexpr uint32_t arg_offset = 3;
+// patch offsets in the json include the 8 byte control packet header
+constexpr uint64_t control_packet_header = 8;
+
+bool
+is_number(const std::string& s)
+{
+  return !s.empty() && std::all_of(s.begin(), s.end(), ::isdigit);
+}
+
+}
+
+aie2_blob_elf_updater::
+aie2_blob_elf_updater(const std::vector<char>& elf)
+{
+  boost::interprocess::ibufferstream istr(elf.data(), elf.size());
+  if (!m_elf.load(istr))
+    throw error(error::error_code::invalid_buffer_type, "Invalid ELF buffer !!!");
+
+  if (m_elf.get_os_abi() != aie2_blob_elf_writer::ob_abi)
+    throw error(error::error_code::invalid_buffer_type, "Only aie2 ELFs can be updated !!!");
+
+  // keep the layout the ELF was built with
+  m_options.set_elf64(m_elf.get_class() == ELFIO::ELFCLASS64);
+  m_options.set_dynsym_hash(m_elf.sections[".hash"] != nullptr);
+  m_options.set_packed_reloc(m_elf.sections[".rela.packed"] != nullptr);
+
+  read_sections();
+  read_symbols();
+}
+
+void
+aie2_blob_elf_updater::
+read_sections()
+{
+  // sections sharing their bytes were built with dedup_sections
+  std::set<ELFIO::Elf64_Off> offsets;
+  ELFIO::Elf_Half sec_num = m_elf.sections.size();
+  for (ELFIO::Elf_Half i = 0; i < sec_num; ++i)
+  {
+    const ELFIO::section* sec = m_elf.sections[i];
+    if (sec->get_type() != ELFIO::SHT_PROGBITS)
+      continue;
+    if (sec->get_size() && !offsets.insert(sec->get_offset()).second)
+      m_options.set_dedup_sections(true);
+
+    auto bytes = reinterpret_cast<const uint8_t*>(sec->get_data());
+    std::vector<uint8_t> data(bytes, bytes + sec->get_size());
+    auto type = (sec->get_flags() & ELFIO::SHF_EXECINSTR) ? code_section::text : code_section::data;
+    m_sections.emplace_back(sec->get_name(), type, data);
+  }
+}
+
+void
+aie2_blob_elf_updater::
+read_symbols()
+{
+  ELFIO::section* dsym_sec = m_elf.sections[".dynsym"];
+  if (!dsym_sec)
+    return;
+
+  struct dynsym
+  {
+    std::string name;
+    uint64_t size;
+    std::string section_name;
+  };
+  std::vector<dynsym> dynsyms;
+  ELFIO::symbol_section_accessor syma(m_elf, dsym_sec);
+  for (ELFIO::Elf_Xword index = 0; index < syma.get_symbols_num(); ++index)
+  {
+    std::string name;
+    ELFIO::Elf64_Addr value;
+    ELFIO::Elf_Xword size;
+    unsigned char bind, type, other;
+    ELFIO::Elf_Half section_index;
+    syma.get_symbol(index, name, value, size, bind, type, section_index, other);
+    const ELFIO::section* sec = m_elf.sections[section_index];
+    dynsyms.push_back({name, size, sec ? sec->get_name() : ""});
+  }
+
+  std::vector<packed_relocation> relocs;
+  if (m_options.get_packed_reloc())
+  {
+    const ELFIO::section* psec = m_elf.sections[".rela.packed"];
+    // groups come back in order of first appearance, re-encoding them and
+    // deriving .dynsym from them gives the same order again
+    relocs = decode_packed_relocations(psec->get_data(), psec->get_size());
+  }
+  else if (ELFIO::section* rel_sec = m_elf.sections[".rela.dyn"])
+  {
+    ELFIO::relocation_section_accessor rela(m_elf, rel_sec);
+    for (ELFIO::Elf_Xword index = 0; index < rela.get_entries_num(); ++index)
+    {
+      ELFIO::Elf64_Addr offset;
+      ELFIO::Elf_Word sym_index;
+      unsigned type;
+      ELFIO::Elf_Sxword addend;
+      rela.get_entry(index, offset, sym_index, type, addend);
+      relocs.push_back({offset, sym_index, static_cast<uint8_t>(type), addend});
+    }
+  }
+
+  for (const auto& reloc : relocs)
+  {
+    if (reloc.sym_index >= dynsyms.size())
+      throw error(error::error_code::invalid_buffer_type, "Relocation with invalid symbol index "
+                  + std::to_string(reloc.sym_index) + " !!!");
+    const auto& sym = dynsyms[reloc.sym_index];
+    m_symbols.emplace_back(sym.name, static_cast<uint32_t>(reloc.offset), 0, 0,
+                           static_cast<uint64_t>(reloc.addend), sym.size, sym.section_name,
+                           static_cast<symbol::patch_schema>(reloc.schema));
+  }
+}
+
+writer*
+aie2_blob_elf_updater::
+find_section(const std::string& name)
+{
+  auto it = std::find_if(m_sections.begin(), m_sections.end(),
+                         [&name](const writer& w) { return !w.get_name().compare(name); });
+  return (it == m_sections.end()) ? nullptr : &*it;
+}
+
+void
+aie2_blob_elf_updater::
+replace_section(const std::string& name, const std::vector<char>& buffer)
+{
+  std::vector<uint8_t> data(buffer.begin(), buffer.end());
+  if (auto sec = find_section(name))
+  {
+    sec->set_data(data);
+    return;
+  }
+
+  // blob sections are emitted in name order, see aie2_blob_preprocessed_output
+  std::vector<writer> sections;
+  bool added = false;
+  for (const auto& sec : m_sections)
+  {
+    if (!added && sec.get_name().compare(name) > 0)
+    {
+      sections.emplace_back(name, code_section::data, data);
+      added = true;
+    }
+    sections.push_back(sec);
+  }
+  if (!added)
+    sections.emplace_back(name, code_section::data, data);
+  m_sections = std::move(sections);
+}
+
+void
+aie2_blob_elf_updater::
+replace_pm_ctrlpkt(uint8_t id, const std::vector<char>& buffer)
+{
+  auto name = ".ctrlpkt.pm." + std::to_string(id);
+  // the control code only patches pm control packets it was built with
+  if (!find_section(name))
+    throw error(error::error_code::invalid_asm, "PM control packet " + std::to_string(id)
+                + " is not in the ELF, assemble it again !!!");
+
+  auto argname = "ctrlpkt-pm-" + std::to_string(id);
+  for (const auto& sym : m_symbols)
+  {
+    if (sym.get_name().compare(argname) || buffer.size() >= sym.get_size())
+      continue;
+    auto error_msg = boost::format("PM control packet: %d size: %lx is lesser then size in blockwrite: %lx")
+                                   % static_cast<int>(id) % buffer.size() % sym.get_size();
+    throw error(error::error_code::invalid_asm, error_msg.str());
+  }
+  replace_section(name, buffer);
+}
+
+void
+aie2_blob_elf_updater::
+replace_patch_json(const std::vector<char>& patch_json)
+{
+  std::vector<char> control_packet;
+  if (auto sec = find_section(ctrldata))
+    control_packet.assign(sec->get_data().begin(), sec->get_data().end());
+
+  aie2_blob_transaction_preprocessor_input input;
+  input.set_options(m_options);
+  input.set_patch_json(patch_json, control_packet);
+
+  const auto& xrt_id_map = input.get_xrt_id_map();
+  bool has_control_packet_arg = std::any_of(xrt_id_map.begin(), xrt_id_map.end(),
+                                            [](const auto& id) { return !id.second.compare(control_packet_arg); });
+
+  // json patches come first, followed by the control code ones, the same
+  // order a full assembly adds them in
+  std::vector<symbol> syms = input.get_symbols();
+  for (const auto& sym : m_symbols)
+  {
+    if (!sym.get_section_name().compare(ctrldata))
+      continue;
+
+    // shim BD args are named through the json xrt_id map, only the control
+    // packet arg gets a name other than its index
+    auto name = sym.get_name();
+    if (sym.get_schema() == symbol::patch_schema::shim_dma_48)
+    {
+      if (!name.compare(control_packet_arg) && !has_control_packet_arg)
+        throw error(error::error_code::invalid_asm, "Patch json has no control packet arg, assemble it again !!!");
+
+      if (is_number(name) && std::stoul(name) >= arg_offset)
+      {
+        auto it = xrt_id_map.find(static_cast<uint32_t>(std::stoul(name) - arg_offset));
+        if (it != xrt_id_map.end())
+          name = it->second;
+      }
+    }
+    syms.emplace_back(name, static_cast<uint32_t>(sym.get_pos()), sym.get_colnum(), sym.get_pagenum(),
+                      sym.get_addend(), sym.get_size(), sym.get_section_name(), sym.get_schema());
+  }
+  m_symbols = std::move(syms);
+}
+
+void
+aie2_blob_elf_updater::
+validate_control_packet_patches()
+{
+  auto sec = find_section(ctrldata);
+  uint64_t size = sec ? sec->get_data().size() : 0;
+  for (const auto& sym : m_symbols)
+  {
+    if (sym.get_section_name().compare(ctrldata))
+      continue;
+    if (sym.get_pos() + control_packet_header > size)
+      throw error(error::error_code::invalid_asm, "Control packet patch at offset "
+                  + std::to_string(sym.get_pos() + control_packet_header)
+                  + " is past the control packet size " + std::to_string(size) + " !!!");
+  }
+}
+
+std::vector<char>
+aie2_blob_elf_updater::
+update(const std::vector<char>& control_packet,
+       const std::vector<char>& patch_json,
+       const std::map<uint8_t, std::vector<char>>& pm_ctrlpkt)
+{
+  if (!control_packet.empty())
+    replace_section(ctrldata, control_packet);
+
+  for (const auto& [id, buffer] : pm_ctrlpkt)
+    replace_pm_ctrlpkt(id, buffer);
+
+  if (!patch_json.empty())
+    replace_patch_json(patch_json);
+  else
+    validate_control_packet_patches();
+
+  if (m_sections.empty())
+    throw error(error::error_code::invalid_buffer_type, "ELF has no sections to update !!!");
+
+  // as aie2_blob_encoder does, all symbols are carried by the first section
+  m_sections.front().add_symbols(m_symbols);
+  aie2_blob_elf_writer elfwriter(m_options);
+  return elfwriter.process(m_sections);
+}
+
+}
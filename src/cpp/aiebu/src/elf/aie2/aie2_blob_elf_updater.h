@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_ELF_AIE2_BLOB_ELF_UPDATER_H_
+#define _AIEBU_ELF_AIE2_BLOB_ELF_UPDATER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include "assembler_options.h"
+#include "symbol.h"
+#include "writer.h"
+#include "elfio/elfio.hpp"
+
+namespace aiebu {
+
+// Rebuild an aie2 blob ELF with a replaced control packet, pm control
+// packets or patch json, without scanning the control code again.
+//
+// The sections and relocations of the ELF are read back as the encoder
+// produced them and passed to aie2_blob_elf_writer again, so .dynsym,
+// .rela.dyn (or .rela.packed), .dynamic and the UID note are regenerated
+// while .ctrltext and its patches are reused as they are. With a new patch
+// json the .ctrldata patches are redone from it, the output is then what a
+// full assembly with the same inputs produces.
+//
+// Not supported, these need a full assembly: adding a pm control packet the
+// ELF was built without, moving the control packet argument to another
+// index and ELFs built with resolved args.
+class aie2_blob_elf_updater
+{
+  ELFIO::elfio m_elf;
+  assembler_options m_options;
+  // progbits sections in ELF order
+  std::vector<writer> m_sections;
+  // relocations in ELF order
+  std::vector<symbol> m_symbols;
+
+  void read_sections();
+  void read_symbols();
+  writer* find_section(const std::string& name);
+  void replace_section(const std::string& name, const std::vector<char>& buffer);
+  void replace_pm_ctrlpkt(uint8_t id, const std::vector<char>& buffer);
+  void replace_patch_json(const std::vector<char>& patch_json);
+  void validate_control_packet_patches();
+
+public:
+  explicit aie2_blob_elf_updater(const std::vector<char>& elf);
+
+  std::vector<char>
+  update(const std::vector<char>& control_packet,
+         const std::vector<char>& patch_json,
+         const std::map<uint8_t, std::vector<char>>& pm_ctrlpkt);
+};
+
+}
+#endif //_AIEBU_ELF_AIE2_BLOB_ELF_UPDATER_H_
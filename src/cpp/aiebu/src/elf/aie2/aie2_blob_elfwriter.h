@@ -10,10 +10,11 @@ namespace aiebu {
 
 class aie2_blob_elf_writer: public elf_writer
 {
+public:
   constexpr static unsigned char ob_abi = 0x45;
   constexpr static unsigned char version = 0x02;
-public:
-  aie2_blob_elf_writer(): elf_writer(ob_abi, version)
+
+  explicit aie2_blob_elf_writer(const assembler_options& options): elf_writer(ob_abi, version, options)
   { }
 };
 
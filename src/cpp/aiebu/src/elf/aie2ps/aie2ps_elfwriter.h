@@ -13,7 +13,7 @@ class aie2ps_elf_writer: public elf_writer
   constexpr static int ob_abi = 0x40;
   constexpr static int version = 0x02;
 public:
-  aie2ps_elf_writer(): elf_writer(ob_abi, version)
+  explicit aie2ps_elf_writer(const assembler_options& options): elf_writer(ob_abi, version, options)
   { }
 };
 
@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: MIT
 // Copyright (C) 2024, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
 #include "elfwriter.h"
+#include "packed_reloc.h"
 
 namespace aiebu {
 
@@ -93,6 +98,71 @@ add_dynsym_section(ELFIO::string_section_accessor* stra, std::vector<symbol>& sy
 
 }
 
+// Standard SysV ELF hash as used by DT_HASH
+static uint32_t
+elf_hash(const std::string& name)
+{
+  uint32_t h = 0;
+  for (unsigned char c : name) {
+    h = (h << 4) + c;
+    uint32_t g = h & 0xf0000000;
+    if (g)
+      h ^= g >> 24;
+    h &= ~g;
+  }
+  return h;
+}
+
+void
+elf_writer::
+add_hash_section()
+{
+  // Bucket counts as used by GNU ld, pick the largest not above the symbol count
+  static const std::vector<uint32_t> bucket_sizes = {
+    1, 3, 17, 37, 67, 97, 131, 197, 263, 521, 1031, 2053, 4099, 8209, 16411, 32771
+  };
+
+  ELFIO::section* dsym_sec = m_elfio.sections[".dynsym"];
+  ELFIO::symbol_section_accessor syma(m_elfio, dsym_sec);
+  auto nchain = static_cast<uint32_t>(syma.get_symbols_num());
+  uint32_t nbucket = bucket_sizes.front();
+  for (auto size : bucket_sizes) {
+    if (size > nchain)
+      break;
+    nbucket = size;
+  }
+
+  // Layout: nbucket, nchain, bucket[nbucket], chain[nchain]
+  std::vector<uint32_t> table(2 + nbucket + nchain, 0);
+  table[0] = nbucket;
+  table[1] = nchain;
+  uint32_t* bucket = table.data() + 2;
+  uint32_t* chain = bucket + nbucket;
+  // symbol 0 is the undefined symbol and never hashed
+  for (uint32_t index = 1; index < nchain; ++index) {
+    std::string name;
+    ELFIO::Elf64_Addr value;
+    ELFIO::Elf_Xword size;
+    unsigned char bind, type, other;
+    ELFIO::Elf_Half section_index;
+    syma.get_symbol(index, name, value, size, bind, type, section_index, other);
+    auto b = elf_hash(name) % nbucket;
+    chain[index] = bucket[b];
+    bucket[b] = index;
+  }
+
+  elf_section sec_data;
+  sec_data.set_name(".hash");
+  sec_data.set_type(ELFIO::SHT_HASH);
+  sec_data.set_flags(ELFIO::SHF_ALLOC);
+  sec_data.set_align(WORD_SIZE);
+  auto bytes = reinterpret_cast<const uint8_t*>(table.data());
+  sec_data.set_buffer(std::vector<uint8_t>(bytes, bytes + table.size() * sizeof(uint32_t)));
+  sec_data.set_link(".dynsym");
+  ELFIO::section* hash_sec = add_section(sec_data);
+  hash_sec->set_entry_size(sizeof(uint32_t));
+}
+
 void
 elf_writer::
 add_reldyn_section(std::vector<symbol>& syms)
@@ -115,6 +185,26 @@ add_reldyn_section(std::vector<symbol>& syms)
   }
 }
 
+void
+elf_writer::
+add_packed_reldyn_section(std::vector<symbol>& syms)
+{
+  std::vector<packed_relocation> relocs;
+  relocs.reserve(syms.size());
+  for (auto & sym : syms)
+    relocs.push_back({sym.get_pos(), sym.get_index(), static_cast<uint8_t>(sym.get_schema()),
+                      static_cast<int64_t>(sym.get_addend())});
+
+  elf_section sec_data;
+  sec_data.set_name(".rela.packed");
+  sec_data.set_type(SHT_AIEBU_PACKED_RELA);
+  sec_data.set_flags(ELFIO::SHF_ALLOC);
+  sec_data.set_align(1);
+  sec_data.set_buffer(encode_packed_relocations(relocs));
+  sec_data.set_link(".dynsym");
+  add_section(sec_data);
+}
+
 void
 elf_writer::
 add_dynamic_section_segment()
@@ -133,9 +223,19 @@ add_dynamic_section_segment()
   dyn_sec->set_info( 0 );
 
   ELFIO::dynamic_section_accessor dyn(m_elfio, dyn_sec);
-  ELFIO::section* rel_sec = m_elfio.sections[".rela.dyn"];
-  dyn.add_entry(ELFIO::DT_RELA, rel_sec->get_index());
-  dyn.add_entry(ELFIO::DT_RELASZ, rel_sec->get_size());
+  if (m_options.get_dynsym_hash())
+    dyn.add_entry(ELFIO::DT_HASH, m_elfio.sections[".hash"]->get_index());
+
+  if (m_options.get_packed_reloc()) {
+    ELFIO::section* rel_sec = m_elfio.sections[".rela.packed"];
+    dyn.add_entry(DT_AIEBU_PACKED_RELA, rel_sec->get_index());
+    dyn.add_entry(DT_AIEBU_PACKED_RELASZ, rel_sec->get_size());
+  }
+  else {
+    ELFIO::section* rel_sec = m_elfio.sections[".rela.dyn"];
+    dyn.add_entry(ELFIO::DT_RELA, rel_sec->get_index());
+    dyn.add_entry(ELFIO::DT_RELASZ, rel_sec->get_size());
+  }
 
 
   elf_segment seg_data;
@@ -160,6 +260,51 @@ add_note(ELFIO::Elf_Word type, const std::string& name, const std::string& dec)
   note_writer.add_note( type, "XRT", dec.c_str(), dec.size() );
 }
 
+// Point a section header and its PT_LOAD at the bytes of another section
+template <typename Ehdr, typename Shdr, typename Phdr>
+static void
+share_headers(std::vector<char>& elf, ELFIO::Elf_Half section, ELFIO::Elf_Half segment,
+              ELFIO::Elf_Half original, ELFIO::Elf_Half original_segment)
+{
+  Ehdr ehdr;
+  std::memcpy(&ehdr, elf.data(), sizeof(ehdr));
+
+  Shdr dup, org;
+  char* shdr = elf.data() + ehdr.e_shoff;
+  std::memcpy(&dup, shdr + section * ehdr.e_shentsize, sizeof(dup));
+  std::memcpy(&org, shdr + original * ehdr.e_shentsize, sizeof(org));
+  dup.sh_offset = org.sh_offset;
+  dup.sh_size = org.sh_size;
+  std::memcpy(shdr + section * ehdr.e_shentsize, &dup, sizeof(dup));
+
+  Phdr pdup, porg;
+  char* phdr = elf.data() + ehdr.e_phoff;
+  std::memcpy(&pdup, phdr + segment * ehdr.e_phentsize, sizeof(pdup));
+  std::memcpy(&porg, phdr + original_segment * ehdr.e_phentsize, sizeof(porg));
+  pdup.p_offset = porg.p_offset;
+  pdup.p_filesz = porg.p_filesz;
+  pdup.p_memsz = porg.p_memsz;
+  std::memcpy(phdr + segment * ehdr.e_phentsize, &pdup, sizeof(pdup));
+}
+
+void
+elf_writer::
+share_sections(std::vector<char>& elf) const
+{
+  // ELFIO lays out every section with its own data, the headers of the ones
+  // added without data are patched in the saved image. Loaders read a
+  // section through its header, so sharing the bytes is transparent to them.
+  for (const auto& shared : m_shared)
+  {
+    if (m_options.get_elf64())
+      share_headers<ELFIO::Elf64_Ehdr, ELFIO::Elf64_Shdr, ELFIO::Elf64_Phdr>(elf, shared.section, shared.segment,
+                                                                            shared.original, shared.original_segment);
+    else
+      share_headers<ELFIO::Elf32_Ehdr, ELFIO::Elf32_Shdr, ELFIO::Elf32_Phdr>(elf, shared.section, shared.segment,
+                                                                            shared.original, shared.original_segment);
+  }
+}
+
 std::vector<char>
 elf_writer::
 finalize()
@@ -174,6 +319,8 @@ finalize()
   std::copy(std::istream_iterator<char>(stream),
             std::istream_iterator<char>( ),
             std::back_inserter(v));
+  if (m_options.get_dedup_sections())
+    share_sections(v);
   return v;
 }
 
@@ -181,11 +328,16 @@ void
 elf_writer::
 add_text_data_section(std::vector<writer>& mwriter, std::vector<symbol>& syms)
 {
-  for(auto buffer : mwriter)
+  // payload to the section and PT_LOAD first holding it, the views point
+  // into mwriter
+  std::unordered_map<std::string_view, std::pair<ELFIO::Elf_Half, ELFIO::Elf_Half>> payloads;
+  for(const auto& buffer : mwriter)
   {
     if(buffer.get_data().size())
     {
       m_uid.update(buffer.get_data());
+      std::string_view payload(reinterpret_cast<const char*>(buffer.get_data().data()), buffer.get_data().size());
+      auto original = m_options.get_dedup_sections() ? payloads.find(payload) : payloads.end();
       elf_section sec_data;
       sec_data.set_name(buffer.get_name());
       sec_data.set_type(ELFIO::SHT_PROGBITS);
@@ -194,7 +346,8 @@ add_text_data_section(std::vector<writer>& mwriter, std::vector<symbol>& syms)
       else
         sec_data.set_flags(ELFIO::SHF_ALLOC | ELFIO::SHF_WRITE);
       sec_data.set_align(align);
-      sec_data.set_buffer(buffer.get_data());
+      if (original == payloads.end())
+        sec_data.set_buffer(buffer.get_data());
       sec_data.set_link("");
 
       elf_segment seg_data;
@@ -208,8 +361,12 @@ add_text_data_section(std::vector<writer>& mwriter, std::vector<symbol>& syms)
       seg_data.set_link(buffer.get_name());
       seg_data.set_align(text_align);
 
-      add_section(sec_data);
-      add_segment(seg_data);
+      ELFIO::section* sec = add_section(sec_data);
+      ELFIO::segment* seg = add_segment(seg_data);
+      if (original == payloads.end())
+        payloads.emplace(payload, std::make_pair(sec->get_index(), seg->get_index()));
+      else
+        m_shared.push_back({sec->get_index(), seg->get_index(), original->second.first, original->second.second});
       if (buffer.hassymbols())
       {
         auto lsyms = buffer.get_symbols();
@@ -219,18 +376,120 @@ add_text_data_section(std::vector<writer>& mwriter, std::vector<symbol>& syms)
   }
 }
 
+// Apply a patch the way XRT does at run time, 'pos' points to the start of
+// the BD (or register write) the symbol refers to
+static void
+patch_symbol(writer& buffer, const symbol& sym, uint64_t address)
+{
+  // DDR offset seen by the aie2 shim, added by firmware for the 48 bit schemes
+  constexpr uint64_t ddr_aie_addr_offset = 0x80000000;
+  auto pos = sym.get_pos();
+  auto word = [&](unsigned int index) { return static_cast<uint64_t>(buffer.read_word(pos + index * WORD_SIZE)); };
+  auto set_word = [&](unsigned int index, uint64_t val) { buffer.write_word_at(pos + index * WORD_SIZE, static_cast<uint32_t>(val)); };
+  uint64_t patch = address + sym.get_addend();
+
+  switch (sym.get_schema()) {
+  case symbol::patch_schema::scaler_32: {
+    // size holds the register mask, the value is used as is
+    auto mask = sym.get_size();
+    set_word(0, (word(0) & ~mask) | (address & mask));
+    break;
+  }
+  case symbol::patch_schema::shim_dma_48: {
+    uint64_t base = ((word(2) & 0xFFFF) << 32) | word(1);
+    base += patch + ddr_aie_addr_offset;
+    set_word(1, base & 0xFFFFFFFC);
+    set_word(2, (word(2) & 0xFFFF0000) | (base >> 32));
+    break;
+  }
+  case symbol::patch_schema::control_packet_48: {
+    uint64_t base = ((word(3) & 0xFFF) << 32) | word(2);
+    base += patch + ddr_aie_addr_offset;
+    set_word(2, base & 0xFFFFFFFC);
+    set_word(3, (word(3) & 0xFFFF0000) | (base >> 32));
+    break;
+  }
+  case symbol::patch_schema::uc_dma_remote_ptr_symbol:
+  case symbol::patch_schema::shim_dma_57: {
+    uint64_t base = ((word(8) & 0x1FF) << 48) | ((word(2) & 0xFFFF) << 32) | word(1);
+    base += patch;
+    set_word(1, base & 0xFFFFFFFF);
+    set_word(2, (word(2) & 0xFFFF0000) | ((base >> 32) & 0xFFFF));
+    set_word(8, (word(8) & 0xFFFFFE00) | ((base >> 48) & 0x1FF));
+    break;
+  }
+  case symbol::patch_schema::shim_dma_57_aie4: {
+    uint64_t base = ((word(0) & 0x1FFFFFF) << 32) | word(1);
+    base += patch;
+    set_word(0, (word(0) & 0xFE000000) | ((base >> 32) & 0x1FFFFFF));
+    set_word(1, base & 0xFFFFFFFF);
+    break;
+  }
+  case symbol::patch_schema::control_packet_57: {
+    uint64_t base = ((word(3) & 0x1FFFFFF) << 32) | word(2);
+    base += patch;
+    set_word(2, base & 0xFFFFFFFC);
+    set_word(3, (word(3) & 0xFE000000) | ((base >> 32) & 0x1FFFFFF));
+    break;
+  }
+  default:
+    throw error(error::error_code::internal_error, "Cannot resolve symbol " + sym.get_name() + " with unknown schema !!!");
+  }
+}
+
+void
+elf_writer::
+apply_resolved_symbols(std::vector<writer>& mwriter)
+{
+  // Pre-resolved mode: symbols with a known address are patched into the
+  // section data here and dropped, the rest stay relocatable. With every
+  // symbol resolved the ELF has no .dynsym/.rela.dyn/.dynamic at all.
+  const auto& resolved = m_options.get_resolved();
+  std::map<std::string, writer*> sections;
+  for (auto& buffer : mwriter)
+    sections[buffer.get_name()] = &buffer;
+
+  for (auto& buffer : mwriter)
+  {
+    if (!buffer.hassymbols())
+      continue;
+    std::vector<symbol> remaining;
+    for (const auto& sym : buffer.get_symbols())
+    {
+      auto addr = resolved.find(sym.get_name());
+      if (addr == resolved.end())
+      {
+        remaining.push_back(sym);
+        continue;
+      }
+      auto sec = sections.find(sym.get_section_name());
+      if (sec == sections.end())
+        throw error(error::error_code::internal_error, "Section " + sym.get_section_name() + " not found for symbol " + sym.get_name() + " !!!");
+      patch_symbol(*sec->second, sym, addr->second);
+    }
+    buffer.add_symbols(remaining);
+  }
+}
+
 std::vector<char>
 elf_writer::
 process(std::vector<writer>& mwriter)
 {
   // add sections
   std::vector<symbol> syms;
+  if (!m_options.get_resolved().empty())
+    apply_resolved_symbols(mwriter);
   add_text_data_section(mwriter, syms);
   if (syms.size())
   {
     ELFIO::string_section_accessor str = add_dynstr_section();
     add_dynsym_section(&str, syms);
-    add_reldyn_section(syms);
+    if (m_options.get_dynsym_hash())
+      add_hash_section();
+    if (m_options.get_packed_reloc())
+      add_packed_reldyn_section(syms);
+    else
+      add_reldyn_section(syms);
     add_dynamic_section_segment();
   }
   return finalize();
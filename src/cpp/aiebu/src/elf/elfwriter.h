@@ -8,6 +8,7 @@
 #include <iterator>
 #include "writer.h"
 #include "symbol.h"
+#include "assembler_options.h"
 #include "elfio/elfio.hpp"
 #include "uid_md5.h"
 
@@ -74,22 +75,40 @@ class elf_writer
 protected:
   ELFIO::elfio m_elfio;
   uid_md5 m_uid;
+  assembler_options m_options;
+
+  // With dedup_sections a section whose payload is already in the ELF is
+  // added without data, once the file is laid out its header and its
+  // PT_LOAD are pointed at the bytes of the first section with that payload
+  struct shared_section
+  {
+    ELFIO::Elf_Half section;
+    ELFIO::Elf_Half segment;
+    ELFIO::Elf_Half original;
+    ELFIO::Elf_Half original_segment;
+  };
+  std::vector<shared_section> m_shared;
 
   ELFIO::section* add_section(elf_section& data);
   ELFIO::segment* add_segment(elf_segment& data);
   ELFIO::string_section_accessor add_dynstr_section();
   void add_dynsym_section(ELFIO::string_section_accessor* stra, std::vector<symbol>& syms);
+  void add_hash_section();
   void add_reldyn_section(std::vector<symbol>& syms);
+  void add_packed_reldyn_section(std::vector<symbol>& syms);
   void add_dynamic_section_segment();
   std::vector<char> finalize();
   void add_text_data_section(std::vector<writer>& mwriter, std::vector<symbol>& syms);
+  void apply_resolved_symbols(std::vector<writer>& mwriter);
   void add_note(ELFIO::Elf_Word type, const std::string& name, const std::string& dec);
+  void share_sections(std::vector<char>& elf) const;
 
 public:
 
-  elf_writer(unsigned char abi, unsigned char version)
+  elf_writer(unsigned char abi, unsigned char version, const assembler_options& options)
+    : m_options(options)
   {
-    m_elfio.create(ELFIO::ELFCLASS32, ELFIO::ELFDATA2LSB);
+    m_elfio.create(m_options.get_elf64() ? ELFIO::ELFCLASS64 : ELFIO::ELFCLASS32, ELFIO::ELFDATA2LSB);
     m_elfio.set_os_abi(abi);
     m_elfio.set_abi_version(version);
     m_elfio.set_type( ELFIO::ET_EXEC );
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include "packed_reloc.h"
+#include "aiebu_error.h"
+
+namespace {
+
+void
+write_uleb(std::vector<uint8_t>& out, uint64_t val)
+{
+  do {
+    uint8_t byte = val & 0x7F;
+    val >>= 7;
+    if (val)
+      byte |= 0x80;
+    out.push_back(byte);
+  } while (val);
+}
+
+void
+write_sleb(std::vector<uint8_t>& out, int64_t val)
+{
+  bool more = true;
+  while (more) {
+    uint8_t byte = val & 0x7F;
+    val >>= 7;
+    if ((val == 0 && !(byte & 0x40)) || (val == -1 && (byte & 0x40)))
+      more = false;
+    else
+      byte |= 0x80;
+    out.push_back(byte);
+  }
+}
+
+class reader
+{
+  const uint8_t* m_cur;
+  const uint8_t* m_end;
+
+  uint8_t next()
+  {
+    if (m_cur == m_end)
+      throw aiebu::error(aiebu::error::error_code::internal_error, "Truncated packed relocation section !!!");
+    return *m_cur++;
+  }
+
+public:
+  reader(const char* data, size_t size)
+    : m_cur(reinterpret_cast<const uint8_t*>(data)), m_end(m_cur + size) {}
+
+  uint64_t read_uleb()
+  {
+    uint64_t val = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+    do {
+      if (shift >= 64)
+        throw aiebu::error(aiebu::error::error_code::internal_error, "Invalid LEB128 in packed relocation section !!!");
+      byte = next();
+      val |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    return val;
+  }
+
+  int64_t read_sleb()
+  {
+    int64_t val = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+    do {
+      if (shift >= 64)
+        throw aiebu::error(aiebu::error::error_code::internal_error, "Invalid LEB128 in packed relocation section !!!");
+      byte = next();
+      val |= static_cast<int64_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    if (shift < 64 && (byte & 0x40))
+      val |= -(static_cast<int64_t>(1) << shift);
+    return val;
+  }
+
+  bool done() const { return m_cur == m_end; }
+};
+
+}
+
+namespace aiebu {
+
+std::vector<uint8_t>
+encode_packed_relocations(const std::vector<packed_relocation>& relocs)
+{
+  using group_key = std::tuple<uint32_t, uint8_t, int64_t>;
+
+  // groups are emitted in order of first appearance to keep output stable
+  std::vector<group_key> order;
+  std::map<group_key, std::vector<uint64_t>> groups;
+  for (const auto& reloc : relocs) {
+    group_key key{reloc.sym_index, reloc.schema, reloc.addend};
+    auto it = groups.find(key);
+    if (it == groups.end()) {
+      order.push_back(key);
+      it = groups.emplace(key, std::vector<uint64_t>{}).first;
+    }
+    it->second.push_back(reloc.offset);
+  }
+
+  std::vector<uint8_t> out;
+  write_uleb(out, order.size());
+  for (const auto& key : order) {
+    auto& offsets = groups[key];
+    std::sort(offsets.begin(), offsets.end());
+    write_uleb(out, std::get<0>(key));
+    write_uleb(out, std::get<1>(key));
+    write_sleb(out, std::get<2>(key));
+    write_uleb(out, offsets.size());
+    uint64_t prev = 0;
+    for (auto offset : offsets) {
+      write_uleb(out, offset - prev);
+      prev = offset;
+    }
+  }
+  return out;
+}
+
+std::vector<packed_relocation>
+decode_packed_relocations(const char* data, size_t size)
+{
+  std::vector<packed_relocation> relocs;
+  reader rd(data, size);
+  auto group_count = rd.read_uleb();
+  for (uint64_t group = 0; group < group_count; ++group) {
+    auto sym_index = static_cast<uint32_t>(rd.read_uleb());
+    auto schema = static_cast<uint8_t>(rd.read_uleb());
+    auto addend = rd.read_sleb();
+    auto count = rd.read_uleb();
+    if (!count)
+      throw error(error::error_code::internal_error, "Empty group in packed relocation section !!!");
+    uint64_t offset = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+      offset += rd.read_uleb();
+      relocs.push_back({offset, sym_index, schema, addend});
+    }
+  }
+  if (!rd.done())
+    throw error(error::error_code::internal_error, "Trailing bytes in packed relocation section !!!");
+  return relocs;
+}
+
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_ELF_PACKED_RELOC_H_
+#define _AIEBU_ELF_PACKED_RELOC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aiebu {
+
+// Packed relocations, opt-in replacement for .rela.dyn.
+//
+// Dense patch sites (thousands of scaler_32/shim_dma_48 entries) differ only
+// in their offset, so relocations are grouped by (symbol, schema, addend) and
+// each group stores its sorted offsets as a base plus deltas. All fields are
+// LEB128 encoded, the addend is signed:
+//
+//   uleb group_count
+//   group_count x {
+//     uleb sym_index   ; index into .dynsym
+//     uleb schema      ; symbol::patch_schema
+//     sleb addend
+//     uleb count       ; >= 1
+//     uleb offset      ; first (lowest) offset
+//     uleb delta       ; count - 1 times, ascending
+//   }
+//
+// The section is named ".rela.packed" and is referenced from .dynamic
+// through DT_AIEBU_PACKED_RELA/DT_AIEBU_PACKED_RELASZ.
+constexpr uint32_t SHT_AIEBU_PACKED_RELA = 0x80000001;    // SHT_LOUSER + 1
+constexpr int64_t DT_AIEBU_PACKED_RELA = 0x6000000d;      // DT_LOOS
+constexpr int64_t DT_AIEBU_PACKED_RELASZ = 0x6000000e;    // DT_LOOS + 1
+
+struct packed_relocation
+{
+  uint64_t offset;
+  uint32_t sym_index;
+  uint8_t schema;
+  int64_t addend;
+};
+
+// Encode relocations, order within a group is not preserved as every patch
+// site is independent of the others
+std::vector<uint8_t>
+encode_packed_relocations(const std::vector<packed_relocation>& relocs);
+
+// Decode a .rela.packed section, throws aiebu::error on malformed input
+std::vector<packed_relocation>
+decode_packed_relocations(const char* data, size_t size);
+
+}
+#endif //_AIEBU_ELF_PACKED_RELOC_H_
@@ -58,17 +58,41 @@ process(std::shared_ptr<preprocessed_output> input)
 
   auto& totalcoldata = tinput->get_coldata();
   auto& totalsyms = tinput->get_symbols();
+  auto cache = tinput->get_column_cache();
 
   // for each colnum encode each page
   for (auto coldata: totalcoldata) {
     auto colnum = coldata.first;
     std::string controlpacket_padname;
-    for (auto& lpage : coldata.second->m_pages)
+    if (coldata.second->m_cached)
     {
-      auto cp_name = page_writer(lpage, coldata.second->m_scratchpad, coldata.second->m_labelpageindex,
-                                 coldata.second->m_control_packet_index);
-      if (!cp_name.empty())
-        controlpacket_padname = cp_name.substr(1);
+      // unchanged since the last incremental build
+      auto& cached = coldata.second->m_cached;
+      for (auto& section : cached->sections)
+        twriter.push_back(section);
+      controlpacket_padname = cached->controlpacket_padname;
+    } else {
+      auto first = twriter.size();
+      for (auto& lpage : coldata.second->m_pages)
+      {
+        auto cp_name = page_writer(lpage, coldata.second->m_scratchpad, coldata.second->m_labelpageindex,
+                                   coldata.second->m_control_packet_index);
+        if (!cp_name.empty())
+          controlpacket_padname = cp_name.substr(1);
+      }
+
+      if (cache)
+      {
+        auto e = std::make_shared<column_cache::entry>();
+        e->key = coldata.second->m_cache_key;
+        for (auto i = first; i < twriter.size(); ++i)
+          e->sections.push_back(twriter[i]);
+        e->controlpacket_padname = controlpacket_padname;
+        for (auto& pad : coldata.second->m_scratchpad)
+          e->pad_layout.emplace_back(pad.second->get_offset(), pad.second->get_base());
+        e->report = coldata.second->m_report;
+        cache->put(colnum, e);
+      }
     }
 
     if (!coldata.second->m_scratchpad.size())
@@ -120,17 +144,27 @@ page_writer(page& lpage, std::map<std::string, std::shared_ptr<scratchpad_info>>
   page_header[9] =  high_8(lpage.get_cur_page_len());       // Higher 8 bit of cur_page_len
   page_header[10] =  low_8(lpage.get_in_order_page_len());  // Lower 8 bit of in_order_page_len
   page_header[11] =  high_8(lpage.get_in_order_page_len()); // Higher 8 bit of in_order_page_len
+  auto& ooo_table = lpage.get_ooo_table();
+  if (ooo_table.size())
+  {
+    // the out of order table closes the data section, it is in the page length
+    offset_type ooo_table_offset = lpage.get_cur_page_len() - ooo_table.size() * OOO_TABLE_ENTRY_SIZE;
+    page_header[12] =  low_8(ooo_table_offset);                // Lower 8 bit of out_of_order_table offset
+    page_header[13] =  high_8(ooo_table_offset);               // Higher 8 bit of out_of_order_table offset
+    page_header[14] =  low_8(ooo_table.size());                // Lower 8 bit of out_of_order_table entries
+    page_header[15] =  high_8(ooo_table.size());               // Higher 8 bit of out_of_order_table entries
+  }
 
   auto pagenum = lpage.get_pagenum();
   auto colnum = lpage.get_colnum();
-  // create state
-  std::vector<std::shared_ptr<asm_data>> all;
-  all.insert(all.end(), lpage.m_text.begin(), lpage.m_text.end());
-  all.insert(all.end(), lpage.m_data.begin(), lpage.m_data.end());
-  assembler_state page_state = assembler_state(m_isa, all, scratchpad, labelpageindex, control_packet_index, false);
+  // page view of the column state, positions relative to this page
+  assembler_state page_state(m_isa, lpage.m_text, lpage.m_data, scratchpad, labelpageindex, control_packet_index);
 
   writer textwriter(get_TextSectionName(colnum, pagenum), code_section::text);
   writer datawriter(get_DataSectionName(colnum, pagenum), code_section::data);
+  // a page never outgrows its length, ops are encoded straight into the writers
+  textwriter.reserve(lpage.get_cur_page_len());
+  datawriter.reserve(lpage.get_cur_page_len());
 
   for (auto byte : page_header)
     textwriter.write_byte(byte);
@@ -138,28 +172,24 @@ page_writer(page& lpage, std::map<std::string, std::shared_ptr<scratchpad_info>>
   // encode text section
   offset_type offset = textwriter.tell();
   std::vector<symbol> tsym;
-  for (auto text : lpage.m_text)
+  for (const auto& text : lpage.m_text)
   {
     //TODO add debug info
-    std::string name = text->get_operation()->get_name();
+    const std::string& name = text->get_operation()->get_name();
     if (text->isOpcode())
     {
       page_state.set_pos(textwriter.tell() - offset);
-      std::vector<uint8_t> ret = (*m_isa)[name]->serializer(text->get_operation()->get_args())
-                                               ->serialize(page_state, tsym, colnum, pagenum);
-      for (uint8_t byte : ret) {
-        textwriter.write_byte(byte);
-      }
+      m_isa->at(name)->serialize(text->get_operation(), page_state, textwriter, tsym, colnum, pagenum);
     } else 
       throw error(error::error_code::internal_error, "Invalid operation: " + name + " in TEXT section !!!");
   }
 
   std::vector<symbol> dsym;
   // encode data section
-  for (auto data : lpage.m_data)
+  for (const auto& data : lpage.m_data)
   {
     page_state.set_pos(datawriter.tell() + textwriter.tell() - offset);
-    std::string name = data->get_operation()->get_name();
+    const std::string& name = data->get_operation()->get_name();
     if (!name.compare("eof"))
       continue;
     if (data->isLabel())
@@ -168,25 +198,33 @@ page_writer(page& lpage, std::map<std::string, std::shared_ptr<scratchpad_info>>
     } else if (data->isOpcode())
     {
       //TODO add debug info
-      std::vector<uint8_t> ret = (*m_isa)[name]->serializer(data->get_operation()->get_args())
-                                               ->serialize(page_state, dsym, colnum, pagenum);
-      for (auto byte : ret) {
-        datawriter.write_byte(byte);
-      }
+      m_isa->at(name)->serialize(data->get_operation(), page_state, datawriter, dsym, colnum, pagenum);
     } else 
       throw error(error::error_code::internal_error, "Invalid operation: " + name + " in DATA section !!!");
   }
 
   for (auto &spad : page_state.m_patch)
   {
-    for (auto& arg : spad.second)
+    for (auto& [arg, opnd] : spad.second)
     {
-      offset = page_state.parse_num_arg(arg);
+      offset = page_state.parse_num_arg(arg, opnd);
       patch57(textwriter, datawriter, offset + page_header.size(),
               page_state.m_scratchpad[spad.first.substr(1)]->get_base() + page_state.m_scratchpad[spad.first.substr(1)]->get_offset());
     }
   }
 
+  if (ooo_table.size())
+  {
+    datawriter.padding(lpage.get_cur_page_len() - ooo_table.size() * OOO_TABLE_ENTRY_SIZE - textwriter.tell());
+    for (auto& [index, len] : ooo_table)
+    {
+      datawriter.write_byte(low_8(index));
+      datawriter.write_byte(high_8(index));
+      datawriter.write_byte(low_8(len));
+      datawriter.write_byte(high_8(len));
+    }
+  }
+
   datawriter.padding(PAGE_SIZE-textwriter.tell());
 
   textwriter.add_symbols(tsym);
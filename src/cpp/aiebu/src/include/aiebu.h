@@ -23,7 +23,8 @@ enum aiebu_error_code {
   aiebu_invalid_batch_buffer_type,
   aiebu_invalid_buffer_type,
   aiebu_invalid_offset,
-  aiebu_invalid_internal_error
+  aiebu_invalid_internal_error,
+  aiebu_invalid_flag
 };
 
 enum aiebu_assembler_buffer_type {
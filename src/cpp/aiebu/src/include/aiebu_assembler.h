@@ -19,6 +19,31 @@
 
 namespace aiebu {
 
+// Pagination of one aie2ps column, see aiebu_assembler::get_page_report()
+struct page_report
+{
+  // why the pager concluded a page
+  enum class close_reason { size_limit, eop, end };
+
+  struct page_info
+  {
+    uint32_t index = 0;            // page index in the column
+    uint32_t text_bytes = 0;       // page header, instructions and eof
+    uint32_t data_bytes = 0;       // data section content
+    uint32_t align_padding = 0;    // text to data section alignment and page length rounding
+    uint32_t ooo_table_bytes = 0;  // out of order table of pages with more than two targets
+    uint32_t tail_padding = 0;     // unused bytes up to the page size
+    uint32_t jobs = 0;
+    uint32_t labels = 0;
+    close_reason reason = close_reason::end;
+  };
+
+  uint32_t column = 0;
+  // estimated page switches along the expected execution path
+  uint32_t page_transitions = 0;
+  std::vector<page_info> pages;
+};
+
 // Assembler Class
 
 class aiebu_assembler {
@@ -55,6 +80,7 @@ class aiebu_assembler {
      *    : in this case it will package buffer in text section and ctrlpkt_pm_N section of elf respectively.
      * 3. type as asm_aie2ps, buffer1 as asm buffer and buffer2
      *    as empty: in this case it will assemble the asm code and package in elf.
+     *    buffer1 may also be an object returned by get_object().
      *
      * @type           buffer type
      * @instr_buf      first buffer
@@ -73,6 +99,45 @@ class aiebu_assembler {
                const std::vector<std::string>& libpaths = {},
                const std::map<uint8_t, std::vector<char> >& pm_ctrlpkt = {});
 
+    /*
+     * Same as above with assembler flags.
+     * its throws aiebu::error object.
+     *
+     * @flags          assembler flags, "<name>" or "<name>=<value>"
+     *                 packed_reloc: emit packed .rela.packed instead of .rela.dyn
+     *                 dynsym_hash:  emit a .hash (DT_HASH) section for .dynsym
+     *                 elf64:        emit ELFCLASS64 and accept 64-bit addends and sizes
+     *                 include_cache: reuse lexed .include files across assemblies in
+     *                               this process while their size and mtime are unchanged
+     *                 incremental:  reuse pages and sections of aie2ps columns whose asm,
+     *                               includes and pads are unchanged since the last
+     *                               assembly in this process, output is unchanged
+     *                 dedup_sections: store byte identical sections (e.g. the same
+     *                               page on several columns) once in the file, the
+     *                               duplicates' headers point at the same offset,
+     *                               get_report() shows the bytes saved
+     *                 dedup_data:   merge aie2ps data labels of a page whose bodies
+     *                               encode the same (e.g. identical .long BD word
+     *                               tables), references go to the one kept, tables
+     *                               patched by APPLY_OFFSET_57 are never merged
+     *                 resolve=<arg>:<addr>[;...]: patch arg (name or index) with addr
+     *                               at build time, resolved args get no relocations
+     *                 pagination=<greedy|ffd|exec>: aie2ps page packing, greedy
+     *                               (default) fills pages in source order, ffd packs
+     *                               each .eop region first fit decreasing into fewer
+     *                               pages, exec keeps launched jobs with their launcher
+     *                               to save page switches (see get_page_report)
+     */
+    DRIVER_DLLESPEC
+    aiebu_assembler(buffer_type type,
+              const std::vector<char>& buffer1,
+              const std::vector<char>& buffer2,
+              const std::vector<char>& patch_json,
+              const std::vector<std::string>& libs,
+              const std::vector<std::string>& libpaths,
+              const std::map<uint8_t, std::vector<char> >& pm_ctrlpkt,
+              const std::vector<std::string>& flags);
+
     /*
      * Constructor takes buffer type, buffer,
      * and a vector of symbols with their patching information as argument.
@@ -91,6 +156,32 @@ class aiebu_assembler {
               const std::vector<std::string>& libpaths = {},
               const std::vector<char>& patch_json = {});
 
+#ifdef AIEBU_FULL
+    /*
+     * Constructor takes buffer type and separately assembled units and
+     * links them into one elf.
+     * its throws aiebu::error object.
+     * Only asm_aie2ps is supported, each unit is asm or an object returned
+     * by get_object(). Columns of all units are merged, a column's top
+     * level jobs may come from several units and are concatenated in unit
+     * order, any other label may only be defined by one unit. Labels,
+     * pads and jobs are resolved across units, then pages are numbered,
+     * scratchpads laid out and relocations emitted once for the result.
+     *
+     * @type           buffer type
+     * @units          asm or object buffers to link
+     * @patch_json     external_buffer_id json
+     * @libpaths       paths to search for libs
+     * @flags          assembler flags, see above
+     */
+    DRIVER_DLLESPEC
+    aiebu_assembler(buffer_type type,
+              const std::vector<std::vector<char>>& units,
+              const std::vector<char>& patch_json,
+              const std::vector<std::string>& libpaths = {},
+              const std::vector<std::string>& flags = {});
+#endif
+
     /*
      * This function return vector with elf content.
      *
@@ -114,6 +205,90 @@ class aiebu_assembler {
     void
     DRIVER_DLLESPEC
     disassemble(const std::filesystem::path &root) const;
+
+    /*
+     * This function updates an aie2 ELF, built from a transaction, dpu or
+     * asm blob, without assembling it again.
+     * its throws aiebu::error object.
+     * Only the given inputs are replaced, pass empty ones to keep what the
+     * ELF has. The control code is not scanned again, its .ctrltext and
+     * patches are reused; .ctrldata patches are redone from a new
+     * patch_json. The dynamic sections and UID are regenerated, so the
+     * result is what a full assembly of the same inputs produces.
+     * Adding a pm control packet the ELF was built without, moving the
+     * control packet argument and ELFs built with resolve= still need a
+     * full assembly.
+     *
+     * @elf            ELF returned by get_elf()
+     * @control_packet replacement .ctrldata
+     * @patch_json     replacement external_buffer_id json
+     * @pm_ctrlpkt     map of pm id and replacement pm control packet buffer
+     *
+     * return: vector of char with elf content
+     */
+    [[nodiscard]]
+    DRIVER_DLLESPEC
+    static std::vector<char>
+    update_elf(const std::vector<char>& elf,
+               const std::vector<char>& control_packet,
+               const std::vector<char>& patch_json = {},
+               const std::map<uint8_t, std::vector<char> >& pm_ctrlpkt = {});
+
+#ifdef AIEBU_FULL
+    /*
+     * This function parses aie2ps asm and returns it as a binary object.
+     *
+     * The object holds the tokenized jobs, labels, data, scratchpads and
+     * unresolved references of all columns. It can be passed back as the
+     * asm_aie2ps buffer, which then skips parsing the text. .include and
+     * .setpad files are looked up in libpaths, the same as for assembly.
+     * its throws aiebu::error object.
+     *
+     * return: vector of char with object content
+     */
+    [[nodiscard]]
+    DRIVER_DLLESPEC
+    static std::vector<char>
+    get_object(const std::vector<char>& buffer,
+               const std::vector<std::string>& libpaths = {});
+
+    /*
+     * This function links aie2ps asm or object units, as the linking
+     * constructor does, and returns the result as a binary object.
+     * its throws aiebu::error object.
+     *
+     * return: vector of char with object content
+     */
+    [[nodiscard]]
+    DRIVER_DLLESPEC
+    static std::vector<char>
+    link_objects(const std::vector<std::vector<char>>& units,
+                 const std::vector<std::string>& libpaths = {});
+
+    /*
+     * This function paginates aie2ps asm or an object, as assembling it
+     * with the same flags does, and returns the pagination of every column
+     * in column order: how full each page is and why it was concluded.
+     * Nothing is encoded. Pass link_objects() of the units for a linked
+     * build.
+     * its throws aiebu::error object.
+     *
+     * return: page report per column
+     */
+    [[nodiscard]]
+    DRIVER_DLLESPEC
+    static std::vector<page_report>
+    get_page_report(const std::vector<char>& buffer,
+                    const std::vector<std::string>& libpaths = {},
+                    const std::vector<std::string>& flags = {});
+
+    /*
+     * This function prints a get_page_report() result as a table per column.
+     */
+    DRIVER_DLLESPEC
+    static void
+    print_page_report(const std::vector<page_report>& report, std::ostream &stream);
+#endif
 };
 
 } //namespace aiebu
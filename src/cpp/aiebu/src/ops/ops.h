@@ -7,14 +7,17 @@
 #include "utils.h"
 #include "oparg.h"
 #include "assembler_state.h"
+#include "writer.h"
 
 namespace aiebu {
 
 class isa_op;
-class op_serializer;
-class isa_op_serializer;
 class assembler_state;
 
+// Encoders are stateless, the op to size or encode and the isa_op it is an
+// instance of are passed in. An isa_op picks its encoder once, from its
+// name, so sizing and encoding an op allocates nothing and the bytes go
+// straight to the section writer.
 class op_serializer
 {
 protected:
@@ -22,75 +25,71 @@ protected:
   constexpr static uint8_t width_8 = 8;
   constexpr static uint8_t width_16 = 16;
   constexpr static uint8_t width_32 = 32;
-  std::shared_ptr<isa_op> m_opcode;
-  std::vector<std::string> m_args;
 
-public:
-  op_serializer(std::shared_ptr<isa_op> opcode, std::vector<std::string> args):m_opcode(opcode) {
-    for (auto a : args)
-      m_args.emplace_back(a);
+  static void write_word(writer& out, uint32_t val, uint8_t mask = BYTE_MASK)
+  {
+    out.write_byte((val >> FIRST_BYTE_SHIFT) & BYTE_MASK);
+    out.write_byte((val >> SECOND_BYTE_SHIFT) & BYTE_MASK);
+    out.write_byte((val >> THIRD_BYTE_SHIFT) & BYTE_MASK);
+    out.write_byte((val >> FORTH_BYTE_SHIFT) & mask);
   }
-  virtual ~op_serializer() = default;
-
-  const std::vector<std::string>& get_args() const { return m_args; }
-
-  virtual offset_type size(assembler_state& ) { return 0;}
-  virtual offset_type align() {return 0;}
-  virtual std::vector<uint8_t> serialize(assembler_state& /*state*/, std::vector<symbol>& /*symbols*/, uint32_t /*colnum*/, pageid_type /*pagenum*/)
-  { std::vector<uint8_t> v; return v;}
 };
 
 
 class isa_op_serializer: public op_serializer
 {
 public:
-  isa_op_serializer(std::shared_ptr<isa_op> opcode, std::vector<std::string> args):op_serializer(opcode, args) {}
+  static offset_type size(const isa_op& opcode);
 
-  offset_type size(assembler_state& state) override;
-
-  offset_type align() override { return 0; }
-  std::vector<uint8_t> serialize(assembler_state& state, std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum) override;
+  static void serialize(const isa_op& opcode, const operation* op, assembler_state& state, writer& out,
+                        std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum);
 };
 
 class long_op_serializer: public op_serializer
 {
 public:
-  long_op_serializer(std::shared_ptr<isa_op> opcode, std::vector<std::string> args):op_serializer(opcode, args) {}
-
-  offset_type size(assembler_state& /*state*/) override { return 4; }
+  static offset_type size() { return 4; }
 
-  offset_type align() override { return 4; }
-  std::vector<uint8_t> serialize(assembler_state& state, std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum) override;
+  static offset_type align() { return 4; }
+  static void serialize(const operation* op, assembler_state& state, writer& out);
 };
 
 class align_op_serializer: public op_serializer
 {
 public:
-  align_op_serializer(std::shared_ptr<isa_op> opcode, std::vector<std::string> args):op_serializer(opcode, args) {}
-
-  offset_type size(assembler_state& state) override;
+  static offset_type size(const operation* op, assembler_state& state);
 
-  offset_type align() override { return 0; }
-  std::vector<uint8_t> serialize(assembler_state& state, std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum) override;
+  static offset_type align() { return 0; }
+  static void serialize(const isa_op& opcode, const operation* op, assembler_state& state, writer& out);
 };
 
 class ucDmaBd_op_serializer: public op_serializer
 {
 public:
-  ucDmaBd_op_serializer(std::shared_ptr<isa_op> opcode, std::vector<std::string> args):op_serializer(opcode, args) {}
+  static offset_type size() { return 16; }
 
-  offset_type size(assembler_state& /*state*/) override { return 16; }
-
-  offset_type align() override { return 16; }
-  std::vector<uint8_t> serialize(assembler_state& state, std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum) override;
+  static offset_type align() { return 16; }
+  static void serialize(const operation* op, assembler_state& state, writer& out);
 };
 
-class isa_op : public std::enable_shared_from_this<isa_op>
+class isa_op
 {
+  enum class encoding : uint8_t
+  {
+    isa,
+    long_word,
+    align,
+    uc_dma_bd,
+  };
+
 protected:
   std::string m_opname;
   uint8_t m_code;
   std::vector<opArg> m_args;
+  encoding m_encoding;
+  // encoded size of an isa encoded op, fixed by its args
+  offset_type m_size;
+
 public:
   const std::vector<opArg>& get_args() const { return m_args; }
   uint8_t get_code() const { return m_code; }
@@ -99,26 +98,51 @@ public:
   isa_op(std::string opname, uint8_t code, std::vector<opArg> args):m_opname(opname), m_code(code) {
     for (auto a : args)
       m_args.emplace_back(a);
-  }
-
-  std::shared_ptr<isa_op>
-  get_shared_ptr()
-  {
-    return shared_from_this();
-  }
 
-  std::shared_ptr<op_serializer> serializer(std::vector<std::string> args)
-  {
     if (!m_opname.compare(".long"))
-      return std::make_shared<long_op_serializer>(get_shared_ptr(), args);
+      m_encoding = encoding::long_word;
     else if (!m_opname.compare(".align"))
-      return std::make_shared<align_op_serializer>(get_shared_ptr(), args);
+      m_encoding = encoding::align;
     else if (!m_opname.compare("uc_dma_bd"))
-      return std::make_shared<ucDmaBd_op_serializer>(get_shared_ptr(), args);
+      m_encoding = encoding::uc_dma_bd;
     else
-      return std::make_shared<isa_op_serializer>(get_shared_ptr(), args);
+      m_encoding = encoding::isa;
+    m_size = isa_op_serializer::size(*this);
   }
 
+  offset_type size(const operation* op, assembler_state& state) const
+  {
+    switch (m_encoding) {
+    case encoding::long_word:
+      return long_op_serializer::size();
+    case encoding::align:
+      return align_op_serializer::size(op, state);
+    case encoding::uc_dma_bd:
+      return ucDmaBd_op_serializer::size();
+    default:
+      return m_size;
+    }
+  }
+
+  // append the encoded 'op' to 'out', 'state' holds its position
+  void serialize(const operation* op, assembler_state& state, writer& out,
+                 std::vector<symbol>& symbols, uint32_t colnum, pageid_type pagenum) const
+  {
+    switch (m_encoding) {
+    case encoding::long_word:
+      long_op_serializer::serialize(op, state, out);
+      break;
+    case encoding::align:
+      align_op_serializer::serialize(*this, op, state, out);
+      break;
+    case encoding::uc_dma_bd:
+      ucDmaBd_op_serializer::serialize(op, state, out);
+      break;
+    default:
+      isa_op_serializer::serialize(*this, op, state, out, symbols, colnum, pagenum);
+      break;
+    }
+  }
 };
 
 }
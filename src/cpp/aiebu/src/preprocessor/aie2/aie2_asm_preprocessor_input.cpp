@@ -367,7 +367,7 @@ aie2_asm_preprocessor_input::aie2_asm_preprocessor_input() {
   m_mnemonic_table.emplace("XAIE_IO_CUSTOM_OP_DDR_PATCH", std::make_unique<aie2_isa_op_factory<XAIE_IO_CUSTOM_OP_DDR_PATCH_op>>());
 }
 
-std::unique_ptr<aie2_isa_op> aie2_asm_preprocessor_input::assemble_operation(std::shared_ptr<operation> op)
+std::unique_ptr<aie2_isa_op> aie2_asm_preprocessor_input::assemble_operation(const operation* op)
 {
   std::string name = op->get_name();
   std::transform(name.begin(), name.end(), name.begin(), ::toupper);
@@ -379,7 +379,8 @@ std::unique_ptr<aie2_isa_op> aie2_asm_preprocessor_input::assemble_operation(std
   }
 
   /* Look up the matching factory and construct the aie2_isa_op */
-  return iter->second->create_aie2_isa_op(op->get_args());;
+  const auto& args = op->get_args();
+  return iter->second->create_aie2_isa_op(std::vector<std::string>(args.begin(), args.end()));
 }
 
 std::vector<char>
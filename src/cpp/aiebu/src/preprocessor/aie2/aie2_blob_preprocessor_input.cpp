@@ -4,6 +4,7 @@
 #include "aie2_blob_preprocessor_input.h"
 #include "xaiengine.h"
 #include "stx_save_restore_map.h"
+#include "dpu.hpp"
 
 namespace aiebu {
 
@@ -169,7 +170,7 @@ add_preemption_code(uint32_t col)
 
   void
   aie2_blob_preprocessor_input::
-  validate_json(uint32_t offset, uint32_t size, uint32_t arg_index, offset_type type) const {
+  validate_json(uint64_t offset, uint64_t size, uint32_t arg_index, offset_type type) const {
     // Return if the offset and arg_index are within their respective sizes. 
     if ((offset <= size) && (arg_index <= MAX_ARG_INDEX)) {
       return;
@@ -201,14 +202,14 @@ add_preemption_code(uint32_t col)
   extract_coalesed_buffers(const std::string& name,
                            const boost::property_tree::ptree& pt)
   {
-    uint32_t buffer_size = get_32_bit_property(pt, "size_in_bytes");
+    uint64_t buffer_size = get_64_bit_property(pt, "size_in_bytes");
     const auto coalesed_buffers_pt = pt.get_child_optional("coalesed_buffers");
     if (!coalesed_buffers_pt)
       return;
 
     const auto coalesed_buffers = coalesed_buffers_pt.get();
     for (auto coalesed_buffer : coalesed_buffers) {
-      uint32_t buffer_offset = get_32_bit_property(coalesed_buffer.second, "offset_in_bytes");
+      uint64_t buffer_offset = get_64_bit_property(coalesed_buffer.second, "offset_in_bytes");
       uint32_t arg_index = get_32_bit_property(pt, "xrt_id");
       // Check if the buffer offset is within the buffer size
       validate_json(buffer_offset, buffer_size, arg_index, offset_type::COALESED_BUFFER);
@@ -223,7 +224,7 @@ add_preemption_code(uint32_t col)
                                const uint32_t arg_index,
                                const boost::property_tree::ptree& pt)
   {
-    const uint32_t addend = get_32_bit_property(pt, "offset_in_bytes", true);
+    const uint64_t addend = get_64_bit_property(pt, "offset_in_bytes", true);
     const auto control_packet_patch_pt = pt.get_child_optional("control_packet_patch_locations");
     if (!control_packet_patch_pt)
       return;
@@ -305,7 +306,7 @@ add_preemption_code(uint32_t col)
       validate_json(control_packet_offset, control_packet_size, arg_index, offset_type::CONTROL_PACKET);
       // move 8 bytes(header) up for unifying the patching scheme between DPU sequence and transaction-buffer
       uint32_t offset = control_packet_offset - 8;
-      const uint32_t addend = get_32_bit_property(patch, "bo_offset");
+      const uint64_t addend = get_64_bit_property(patch, "bo_offset");
       add_symbol({std::to_string(arg_index + ARG_OFFSET), offset, 0, 0, addend, 0, ctrlData, symbol::patch_schema::control_packet_48});
     }
 
@@ -685,12 +686,12 @@ add_preemption_code(uint32_t col)
     uint32_t offset = input.offset;
     uint64_t buffer_length_in_bytes = input.buffer_length_in_bytes;
 
-    if (input.addend > RANGE_32BIT)
+    if (!m_options.get_elf64() && input.addend > RANGE_32BIT)
     {
       auto error_msg = boost::format("Invalid addend (0x%x) > 32bit found") % input.addend;
       throw error(error::error_code::invalid_asm, error_msg.str());
     }
-    uint32_t addend = static_cast<uint32_t>(input.addend);
+    uint64_t addend = input.addend;
 
     if (argidx > (MAX_ARG_INDEX + ARG_OFFSET))
     {
@@ -792,74 +793,14 @@ add_preemption_code(uint32_t col)
                           const std::string& section_name,
                           const std::string& /*argname*/)
   {
-    // For dpu
+    // For dpu, shim BDs are patched through OP_WRITESHIMBD and OP_WRITEBD on row 0
     auto instr_ptr = reinterpret_cast<const uint32_t*>(mc_code.data());
-    size_t inst_word_size = mc_code.size()/4;
-    size_t pc = 0;
-
-    while (pc < inst_word_size) {
-      uint32_t opcode = (instr_ptr[pc] & 0xFF000000) >> 24;
-      switch(opcode) {
-        case OP_WRITESHIMBD: patch_shimbd(instr_ptr, pc, section_name);
-          pc += OP_WRITESHIMBD_SIZE;
-          break;
-        case OP_WRITEBD:
-        {
-          uint8_t row = (instr_ptr[pc] & 0x0000FF00) >> 8;
-          if (row == 0)
-          {
-            patch_shimbd(instr_ptr, pc, section_name);
-            pc += OP_WRITEBD_SIZE_9;
-          }
-          else if (row == 1)
-            pc += OP_WRITEBD_SIZE_9;
-          else
-            pc += OP_WRITEBD_SIZE_7;
-          break;
-        }
-        case OP_NOOP: pc += OP_NOOP_SIZE;
-          break;
-        case OP_WRITE32: pc += OP_WRITE32_SIZE;
-          break;
-        case OP_WRITEBD_EXTEND_AIETILE: pc += OP_WRITEBD_EXTEND_AIETILE_SIZE;
-          break;
-        case OP_WRITE32_EXTEND_GENERAL: pc += OP_WRITE32_EXTEND_GENERAL_SIZE;
-          break;
-        case OP_WRITEBD_EXTEND_SHIMTILE: pc += OP_WRITEBD_EXTEND_SHIMTILE_SIZE;
-          break;
-        case OP_WRITEBD_EXTEND_MEMTILE: pc += OP_WRITEBD_EXTEND_MEMTILE_SIZE;
-          break;
-        case OP_WRITE32_EXTEND_DIFFBD: pc += OP_WRITE32_EXTEND_DIFFBD_SIZE;
-          break;
-        case OP_WRITEBD_EXTEND_SAMEBD_MEMTILE: pc += OP_WRITEBD_EXTEND_SAMEBD_MEMTILE_SIZE;
-          break;
-        case OP_DUMPDDR: pc += OP_DUMPDDR_SIZE;  //TODO: get pc based on hw/simnow
-          break;
-        case OP_WRITEMEMBD: pc += OP_WRITEMEMBD_SIZE;
-          break;
-        case OP_WRITE32_RTP: pc += OP_WRITE32_RTP_SIZE;
-          break;
-        case OP_READ32: pc += OP_READ32_SIZE;
-          break;
-        case OP_READ32_POLL: pc += OP_READ32_POLL_SIZE;
-          break;
-        case OP_SYNC: pc += OP_SYNC_SIZE;
-          break;
-        case OP_MERGESYNC: pc += OP_MERGESYNC_SIZE;
-          break;
-        case OP_DUMP_REGISTER:
-        { pc += 1;
-          uint32_t count = instr_ptr[pc] & 0x00FFFFFF;
-          uint32_t total = count << 1;
-          pc += total;
-          break;
-        }
-        case OP_RECORD_TIMESTAMP: pc += OP_RECORD_TIMESTAMP_SIZE;
-          break;
-        default:
-          throw error(error::error_code::invalid_asm, "Invalid dpu opcode: " + std::to_string(opcode) + " !!!");
-      }
-    }
+    dpu decoder(mc_code.data(), mc_code.size());
+    decoder.decode([&](const dpu::instruction& inst) {
+      if (inst.opcode == dpu::OP_WRITESHIMBD ||
+          (inst.opcode == dpu::OP_WRITEBD && inst.row() == 0))
+        patch_shimbd(instr_ptr, inst.pc, section_name);
+    });
     return 0;
   }
 }
@@ -71,7 +71,7 @@ protected:
   void extract_control_packet_patch(const std::string& name, const uint32_t arg_index, const boost::property_tree::ptree& _pt);
   void extract_coalesed_buffers(const std::string& name, const boost::property_tree::ptree& _pt);
   void clear_shimBD_address_bits(std::vector<char>& mc_code, uint32_t offset) const;
-  void validate_json(uint32_t offset, uint32_t size, uint32_t arg_index, offset_type type) const;
+  void validate_json(uint64_t offset, uint64_t size, uint32_t arg_index, offset_type type) const;
   uint32_t get_32_bit_property(const boost::property_tree::ptree& pt, const std::string& property, bool defaultvalue = false) const;
   void add_preemption_code(uint32_t col);
 public:
@@ -106,6 +106,21 @@ public:
     if (haspreempt)
       add_preemption_code(col);
   }
+
+  // Parse 'patch_json' against 'control_packet' only, the control code is
+  // not scanned. Used to redo the .ctrldata patches of an existing ELF.
+  void set_patch_json(const std::vector<char>& patch_json, const std::vector<char>& control_packet)
+  {
+    m_data[".ctrldata"] = control_packet;
+    vector_streambuf vsb(patch_json);
+    std::istream elf_stream(&vsb);
+    readmetajson(elf_stream);
+  }
+
+  const std::map<uint32_t, std::string>& get_xrt_id_map() const
+  {
+    return xrt_id_map;
+  }
 };
 
 class aie2_blob_transaction_preprocessor_input : public aie2_blob_preprocessor_input
@@ -163,65 +178,6 @@ public:
 
 class aie2_blob_dpu_preprocessor_input : public aie2_blob_preprocessor_input
 {
-  constexpr static uint32_t OP_NOOP = 0;
-  constexpr static uint32_t OP_NOOP_SIZE = 1;
-
-  constexpr static uint32_t OP_WRITEBD = 1;
-  //OP_WRITEBD_SIZE depend on row (9 for 0/1 and 7 for rest)
-  constexpr static uint32_t OP_WRITEBD_SIZE_9  = 9;
-  constexpr static uint32_t OP_WRITEBD_SIZE_7  = 7;
-
-  constexpr static uint32_t OP_WRITE32 = 2;
-  constexpr static uint32_t OP_WRITE32_SIZE = 3;
-
-  constexpr static uint32_t OP_SYNC = 3;
-  constexpr static uint32_t OP_SYNC_SIZE = 2;
-
-  constexpr static uint32_t OP_WRITEBD_EXTEND_AIETILE = 4;
-  constexpr static uint32_t OP_WRITEBD_EXTEND_AIETILE_SIZE = 8;
-
-  constexpr static uint32_t OP_WRITE32_EXTEND_GENERAL = 5;
-  constexpr static uint32_t OP_WRITE32_EXTEND_GENERAL_SIZE = 3;
-
-  constexpr static uint32_t OP_WRITEBD_EXTEND_SHIMTILE = 6;
-  constexpr static uint32_t OP_WRITEBD_EXTEND_SHIMTILE_SIZE = 10;
-
-  constexpr static uint32_t OP_WRITEBD_EXTEND_MEMTILE = 7;
-  constexpr static uint32_t OP_WRITEBD_EXTEND_MEMTILE_SIZE = 11;
-
-  constexpr static uint32_t OP_WRITE32_EXTEND_DIFFBD = 8;
-  constexpr static uint32_t OP_WRITE32_EXTEND_DIFFBD_SIZE = 4;
-
-  constexpr static uint32_t OP_WRITEBD_EXTEND_SAMEBD_MEMTILE = 9;
-  constexpr static uint32_t OP_WRITEBD_EXTEND_SAMEBD_MEMTILE_SIZE = 9;
-
-  constexpr static uint32_t OP_DUMPDDR = 10;
-  constexpr static uint32_t OP_DUMPDDR_SIZE = 44;
-
-  constexpr static uint32_t OP_WRITESHIMBD = 11;
-  constexpr static uint32_t OP_WRITESHIMBD_SIZE = 9;
-
-  constexpr static uint32_t OP_WRITEMEMBD = 12;
-  constexpr static uint32_t OP_WRITEMEMBD_SIZE = 9;
-
-  constexpr static uint32_t OP_WRITE32_RTP = 13;
-  constexpr static uint32_t OP_WRITE32_RTP_SIZE = 3;
-
-  constexpr static uint32_t OP_READ32 = 14;
-  constexpr static uint32_t OP_READ32_SIZE = 2;
-
-  constexpr static uint32_t OP_READ32_POLL = 15;
-  constexpr static uint32_t OP_READ32_POLL_SIZE = 4;
-
-  constexpr static uint32_t OP_RECORD_TIMESTAMP = 16;
-  constexpr static uint32_t OP_RECORD_TIMESTAMP_SIZE = 1;
-
-  constexpr static uint32_t OP_MERGESYNC = 17;
-  constexpr static uint32_t OP_MERGESYNC_SIZE = 1;
-
-  constexpr static uint32_t OP_DUMP_REGISTER = 18;
-  // OP_DUMP_REGISTER_SIZE is calculated runtime
-
 protected:
   void patch_shimbd(const uint32_t* ins_buffer, size_t pc, const std::string& section_name);
   virtual uint32_t extractSymbolFromBuffer(std::vector<char>& mc_code, const std::string& section_name, const std::string& argname) override;
@@ -249,7 +205,7 @@ private:
   std::map<std::string, std::unique_ptr<aie2_isa_op_factory_base>> m_mnemonic_table;
 
 protected:
-  std::unique_ptr<aie2_isa_op> assemble_operation(std::shared_ptr<operation> op);
+  std::unique_ptr<aie2_isa_op> assemble_operation(const operation* op);
 
 public:
   aie2_asm_preprocessor_input();
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_PREPROCESSOR_AIE2PS_COLUMN_CACHE_H_
+#define _AIEBU_PREPROCESSOR_AIE2PS_COLUMN_CACHE_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "asm/asm_parser.h"
+#include "assembler_options.h"
+#include "uid_md5.h"
+#include "writer.h"
+
+namespace aiebu {
+
+// Encoded columns kept across assemblies in this process, used by the
+// "incremental" flag. A column is keyed by a digest of everything its pages
+// are built from: its label blocks with includes expanded, its scratchpads,
+// the control packet index and the pagination mode. On a hit pagination and
+// encoding of that column are skipped and the cached sections are emitted as
+// they are, which is what a clean build of the same input produces.
+class column_cache
+{
+public:
+  struct entry
+  {
+    std::string key;
+    // .ctrltext.C.P/.ctrldata.C.P in page order
+    std::vector<writer> sections;
+    std::string controlpacket_padname;
+    // offset and base of each scratchpad, in scratchpad map order
+    std::vector<std::pair<offset_type, offset_type>> pad_layout;
+    // pagination of the column
+    page_report report;
+  };
+
+private:
+  std::mutex m_mutex;
+  // latest build of each column, an edit loop only ever asks for that
+  std::map<uint32_t, std::shared_ptr<const entry>> m_entries;
+
+  // feeds uid_md5 in chunks, every field is terminated so field
+  // boundaries are part of the digest
+  class digest_stream
+  {
+    uid_md5 m_md5;
+    std::vector<uint8_t> m_buf;
+    constexpr static size_t chunk = 64 * 1024;
+
+  public:
+    void add(std::string_view str)
+    {
+      m_buf.insert(m_buf.end(), str.begin(), str.end());
+      m_buf.push_back(0);
+      if (m_buf.size() >= chunk)
+      {
+        m_md5.update(m_buf);
+        m_buf.clear();
+      }
+    }
+
+    void add(uint64_t val)
+    {
+      add(std::to_string(val));
+    }
+
+    std::string calculate()
+    {
+      m_md5.update(m_buf);
+      m_buf.clear();
+      return m_md5.calculate();
+    }
+  };
+
+public:
+  static std::string
+  key(uint32_t col, const std::vector<std::string>& labels, col_data& coldata,
+      const std::map<std::string, std::shared_ptr<scratchpad_info>>& scratchpad,
+      uint32_t control_packet_index, pagination_mode pagination, bool dedup_data)
+  {
+    digest_stream ds;
+    ds.add(col);
+    ds.add(control_packet_index);
+    ds.add(static_cast<uint64_t>(pagination));
+    ds.add(static_cast<uint64_t>(dedup_data));
+    for (auto& label : labels)
+    {
+      ds.add(label);
+      for (auto& data : coldata.get_label_asmdata(label))
+      {
+        ds.add(static_cast<uint64_t>(data->isLabel()));
+        // job and label names are made unique with the file name
+        ds.add(data->get_file());
+        ds.add(data->get_operation()->get_name());
+        ds.add(data->get_operation()->get_args().size());
+        for (auto& arg : data->get_operation()->get_args())
+          ds.add(arg);
+      }
+    }
+    for (auto& pad : scratchpad)
+    {
+      ds.add(pad.first);
+      ds.add(pad.second->get_size());
+      auto& content = pad.second->get_content();
+      ds.add(content.size());
+      ds.add(std::string(content.begin(), content.end()));
+    }
+    return ds.calculate();
+  }
+
+  std::shared_ptr<const entry>
+  get(uint32_t col, const std::string& key)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(col);
+    if (it != m_entries.end() && it->second->key == key)
+      return it->second;
+    return nullptr;
+  }
+
+  void
+  put(uint32_t col, std::shared_ptr<const entry> e)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[col] = std::move(e);
+  }
+
+  static std::shared_ptr<column_cache> session()
+  {
+    static auto cache = std::make_shared<column_cache>();
+    return cache;
+  }
+};
+
+}
+#endif //_AIEBU_PREPROCESSOR_AIE2PS_COLUMN_CACHE_H_
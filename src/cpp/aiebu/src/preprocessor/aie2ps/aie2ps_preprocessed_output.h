@@ -5,6 +5,7 @@
 #define _AIEBU_PREPROCESSOR_AIE2PS_PREPROCESSED_OUTPUT_H_
 
 #include "asm/page.h"
+#include "aie2ps_column_cache.h"
 #include "preprocessed_output.h"
 
 namespace aiebu {
@@ -18,10 +19,19 @@ class aie2ps_preprocessed_output : public preprocessed_output
     std::map<std::string, std::shared_ptr<scratchpad_info>> m_scratchpad;
     std::map<std::string, uint32_t> m_labelpageindex;
     uint32_t m_control_packet_index = 0xFFFFFFFF; // default value if control packet not present
+    // pagination of the column, kept for cached columns too
+    page_report m_report;
+    // incremental builds only: digest of the column and its cached
+    // sections when they can be reused, m_pages is left empty then
+    std::string m_cache_key;
+    std::shared_ptr<const column_cache::entry> m_cached;
     coldata(std::vector<page> pages, std::map<std::string, std::shared_ptr<scratchpad_info>> scratchpad, std::map<std::string, uint32_t> labelpageindex, uint32_t control_packet_index): m_pages(std::move(pages)), m_scratchpad(std::move(scratchpad)), m_labelpageindex(std::move(labelpageindex)), m_control_packet_index(control_packet_index) {}
   };
   std::map<uint32_t, std::shared_ptr<coldata>> m_coldata;
   std::vector<symbol> m_sym;
+  // the pages' tokens point into it
+  std::shared_ptr<const asm_arena> m_arena;
+  std::shared_ptr<column_cache> m_column_cache;
 public:
   aie2ps_preprocessed_output() {}
 
@@ -30,6 +40,25 @@ public:
     m_coldata[col] = std::make_shared<coldata>(pages, scratchpad, labelpageindex, control_packet_index);
   }
 
+  void set_page_report(const uint32_t col, const page_report& report)
+  {
+    m_coldata[col]->m_report = report;
+  }
+
+  std::vector<page_report> get_page_report() const override
+  {
+    std::vector<page_report> report;
+    for (auto& coldata : m_coldata)
+      report.push_back(coldata.second->m_report);
+    return report;
+  }
+
+  void set_colcache(const uint32_t col, const std::string& key, std::shared_ptr<const column_cache::entry> cached)
+  {
+    m_coldata[col]->m_cache_key = key;
+    m_coldata[col]->m_cached = std::move(cached);
+  }
+
   const std::map<uint32_t, std::shared_ptr<coldata>>& get_coldata() const
   {
     return m_coldata;
@@ -44,6 +73,21 @@ public:
   {
     m_sym = std::move(syms);
   }
+
+  void set_column_cache(std::shared_ptr<column_cache> cache)
+  {
+    m_column_cache = std::move(cache);
+  }
+
+  std::shared_ptr<column_cache> get_column_cache() const
+  {
+    return m_column_cache;
+  }
+
+  void set_arena(std::shared_ptr<const asm_arena> arena)
+  {
+    m_arena = std::move(arena);
+  }
 };
 
 }
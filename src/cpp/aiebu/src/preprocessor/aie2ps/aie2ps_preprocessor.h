@@ -4,9 +4,14 @@
 #ifndef _AIEBU_PREPROCESSOR_AIE2PS_PREPROCESSOR_H_
 #define _AIEBU_PREPROCESSOR_AIE2PS_PREPROCESSOR_H_
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <string>
+#include <thread>
 #include "preprocessor.h"
 #include "asm/asm_parser.h"
+#include "asm/asm_object.h"
 #include "assembler_state.h"
 #include "asm/pager.h"
 #include "aie2ps_preprocessor_input.h"
@@ -18,6 +23,109 @@ namespace aiebu {
 class aie2ps_preprocessor: public preprocessor
 {  
   std::shared_ptr<std::map<std::string, std::shared_ptr<isa_op>>> m_isa;
+  pagination_mode m_pagination = pagination_mode::greedy;
+  bool m_dedup_data = false;
+
+  // Per column input and result. Columns share nothing but the read only
+  // isa map, so they are paginated in parallel and collected in order.
+  struct col_job
+  {
+    uint32_t col;
+    std::vector<std::string> labels;
+    col_data* coldata;
+    std::map<std::string, uint32_t>* label_page_index;
+    std::map<std::string, std::shared_ptr<scratchpad_info>>* scratchpad;
+    std::vector<page> pages;
+    std::exception_ptr err;
+    page_report report;
+    // incremental builds only
+    std::string cache_key;
+    std::shared_ptr<const column_cache::entry> cached;
+  };
+
+  // Look the column up in 'cache', on a hit restore the scratchpad layout
+  // the cached sections were encoded with instead of paginating
+  bool
+  reuse_col(col_job& cj, column_cache& cache, uint32_t control_packet_index)
+  {
+    auto& scratchpad = *cj.scratchpad;
+    cj.cache_key = column_cache::key(cj.col, cj.labels, *cj.coldata, scratchpad, control_packet_index,
+                                     m_pagination, m_dedup_data);
+    cj.cached = cache.get(cj.col, cj.cache_key);
+    if (!cj.cached)
+      return false;
+
+    auto layout = cj.cached->pad_layout.begin();
+    for (auto& pad : scratchpad)
+    {
+      pad.second->set_offset(layout->first);
+      pad.second->set_base(layout->second);
+      ++layout;
+    }
+    cj.report = cj.cached->report;
+    return true;
+  }
+
+  void
+  paginate_col(col_job& cj)
+  {
+    auto col = cj.col;
+    auto& pages = cj.pages;
+    auto& label_page_index = *cj.label_page_index;
+    auto& scratchpad = *cj.scratchpad;
+    int relative_page_index = 0;
+    int pad_size = 0;
+    for (auto& label : cj.labels)
+    {
+      // create state
+      std::vector<asm_data*> data = cj.coldata->get_label_asmdata(label);
+      assembler_state state = assembler_state(m_isa, data, scratchpad, label_page_index, 0, true);
+      // create pages
+      pager pgr(PAGE_SIZE, m_pagination, m_dedup_data);
+      pgr.pagify(state, col, pages, relative_page_index);
+      cj.report.page_transitions += pgr.get_transitions();
+      label_page_index[get_pagelabel(label)] = relative_page_index;
+      relative_page_index = pages.size();
+    }
+
+    for (auto& pad : scratchpad)
+    {
+      pad_size = (((pad_size + 3) >> 2) << 2); // round off to next multiple of 4
+      pad.second->set_offset(pad_size);
+      pad.second->set_base(PAGE_SIZE * relative_page_index);
+      pad_size += pad.second->get_size();
+    }
+
+    for (auto&page : pages)
+    {
+      // out of order targets of all groups in the page, the first two also
+      // go to the header slots
+      std::vector<std::string> ooo;
+      for (auto& label : page.getout_of_order_page())
+        if (page.getout_of_order_page().size() <= OOO_HEADER_SLOTS || std::find(ooo.begin(), ooo.end(), label) == ooo.end())
+          ooo.push_back(label);
+
+      std::vector<std::pair<uint32_t, uint32_t>> ooo_pages;
+      for (auto& label : ooo)
+      {
+        auto it = label_page_index.find(get_pagelabel(label));
+        if (it == label_page_index.end())
+          throw error(error::error_code::invalid_asm, "Label " + get_pagelabel(label) + " not present in col:" + std::to_string(col) + "\n");
+        ooo_pages.emplace_back(it->second, pages[it->second].get_cur_page_len());
+      }
+
+      auto ooo_page_len_1 = ooo_pages.size() ? ooo_pages[0].second : 0;
+      auto ooo_page_len_2 = (ooo_pages.size() >= 2) ? ooo_pages[1].second : 0;
+      page.set_ooo_page_len(ooo_page_len_1,ooo_page_len_2);
+      if (ooo_pages.size() > OOO_HEADER_SLOTS)
+        page.set_ooo_table(std::move(ooo_pages));
+    }
+
+    cj.report.column = col;
+    for (auto& page : pages)
+      cj.report.pages.push_back(page.get_info());
+  }
+
 public:
   aie2ps_preprocessor() {}
 
@@ -31,59 +139,70 @@ public:
     auto toutput = std::make_shared<aie2ps_preprocessed_output>();
     //auto keys = tinput->get_keys();
     std::shared_ptr<asm_parser> parser(new asm_parser(tinput->get_data(), tinput->get_include_paths()));
-    parser->parse_lines();
+    if (tinput->get_options().get_include_cache())
+      parser->set_include_cache(include_cache::session());
+    if (is_asm_object(tinput->get_data()))
+      parser->parse_object();
+    else
+      parser->parse_lines();
     auto collist = parser->get_col_list();
+    std::sort(collist.begin(), collist.end());
     isa i;
     m_isa = i.get_isamap();
+    m_pagination = tinput->get_options().get_pagination();
+    m_dedup_data = tinput->get_options().get_dedup_data();
 
-    for (auto col: collist)
+    // look up everything touching the parser's maps before going parallel
+    std::vector<col_job> jobs(collist.size());
+    for (size_t idx = 0; idx < collist.size(); ++idx)
     {
-      std::vector<page> pages;
-      int relative_page_index = 0;
-      int pad_size = 0;
-      auto& label_page_index = parser->getcollabelpageindex(col);
-      auto& scratchpad = parser->getcolscratchpad(col);
-      auto& coldata = parser->get_col_asmdata(col);
-      for (auto label : parser->getLabelsforcol(col))
-      {
-        // create state
-        std::vector<std::shared_ptr<asm_data>> data = coldata.get_label_asmdata(label);
-        assembler_state state = assembler_state(m_isa, data, scratchpad, label_page_index, 0, true);
-        // create pages
-        pager(PAGE_SIZE).pagify(state, col, pages, relative_page_index);
-        label_page_index[get_pagelabel(label)] = relative_page_index;
-        relative_page_index = pages.size();
-      }
+      auto col = collist[idx];
+      jobs[idx].col = col;
+      jobs[idx].labels = parser->getLabelsforcol(col);
+      jobs[idx].coldata = &parser->get_col_asmdata(col);
+      jobs[idx].label_page_index = &parser->getcollabelpageindex(col);
+      jobs[idx].scratchpad = &parser->getcolscratchpad(col);
+    }
 
-      for (auto& pad : scratchpad)
-      {
-        pad_size = (((pad_size + 3) >> 2) << 2); // round off to next multiple of 4
-        pad.second->set_offset(pad_size);
-        pad.second->set_base(PAGE_SIZE * relative_page_index);
-        pad_size += pad.second->get_size();
-      }
+    std::shared_ptr<column_cache> cache;
+    if (tinput->get_options().get_incremental())
+      cache = column_cache::session();
 
-      for (auto&page : pages)
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+      for (size_t idx = next++; idx < jobs.size(); idx = next++)
       {
-        auto &ooo = page.getout_of_order_page();
-        if (ooo.size() > 2)
-          throw error(error::error_code::invalid_asm, "Only 2 out of order branching supported\n");
-
-        if (ooo.size() == 2)
-          if (label_page_index.find(get_pagelabel(ooo[1])) == label_page_index.end())
-            throw error(error::error_code::invalid_asm, "Label " + get_pagelabel(ooo[1]) + " not present in col:" + std::to_string(col) + "\n");
+        try {
+          if (!cache || !reuse_col(jobs[idx], *cache, tinput->get_control_packet_index()))
+            paginate_col(jobs[idx]);
+        }
+        catch (...) {
+          jobs[idx].err = std::current_exception();
+        }
+      }
+    };
 
-        if (ooo.size() == 1)
-          if (label_page_index.find(get_pagelabel(ooo[0])) == label_page_index.end())
-            throw error(error::error_code::invalid_asm, "Label " + get_pagelabel(ooo[0]) + " not present in col:" + std::to_string(col) + "\n");
+    size_t nthreads = std::min<size_t>(jobs.size(), std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < nthreads; ++t)
+      threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+      t.join();
 
-        auto ooo_page_len_1 = ooo.size() ? pages[label_page_index.at(get_pagelabel(ooo[0]))].get_cur_page_len() : 0;
-        auto ooo_page_len_2 = (ooo.size() == 2) ? pages[label_page_index.at(get_pagelabel(ooo[1]))].get_cur_page_len() : 0;
-        page.set_ooo_page_len(ooo_page_len_1,ooo_page_len_2);
-      }
-      toutput->set_coldata(col, pages, scratchpad, label_page_index, tinput->get_control_packet_index());
+    // report the error of the lowest failing column, same as a serial run
+    for (auto& cj : jobs)
+    {
+      if (cj.err)
+        std::rethrow_exception(cj.err);
+      toutput->set_coldata(cj.col, cj.pages, *cj.scratchpad, *cj.label_page_index, tinput->get_control_packet_index());
+      toutput->set_page_report(cj.col, cj.report);
+      if (cache)
+        toutput->set_colcache(cj.col, cj.cache_key, cj.cached);
     }
+    toutput->set_column_cache(cache);
     toutput->add_symbols(tinput->get_symbols());
+    toutput->set_arena(parser->share_arena());
     return toutput;
   }
 };
@@ -8,7 +8,7 @@ namespace aiebu {
   //TODO: this these functions are custom copy from aie2_preprocessor_input.cpp, todo we mode both in common place
   void
   aie2ps_preprocessor_input::
-  validate_json(uint32_t /*offset*/, uint32_t /*size*/, uint32_t /*arg_index*/, offset_type /*type*/) const {
+  validate_json(uint64_t /*offset*/, uint64_t /*size*/, uint32_t /*arg_index*/, offset_type /*type*/) const {
     // Return if the offset and arg_index are within their respective sizes.
     // TODO enable checks
     /*
@@ -43,14 +43,14 @@ namespace aiebu {
   extract_coalesed_buffers(const std::string& name,
                            const boost::property_tree::ptree& pt)
   {
-    uint32_t buffer_size = get_32_bit_property(pt, "size_in_bytes");
+    uint64_t buffer_size = get_64_bit_property(pt, "size_in_bytes");
     const auto coalesed_buffers_pt = pt.get_child_optional("coalesed_buffers");
     if (!coalesed_buffers_pt)
       return;
 
     const auto coalesed_buffers = coalesed_buffers_pt.get();
     for (auto coalesed_buffer : coalesed_buffers) {
-      uint32_t buffer_offset = get_32_bit_property(coalesed_buffer.second, "offset_in_bytes");
+      uint64_t buffer_offset = get_64_bit_property(coalesed_buffer.second, "offset_in_bytes");
       uint32_t arg_index = get_32_bit_property(pt, "xrt_id");
       // Check if the buffer offset is within the buffer size
       validate_json(buffer_offset, buffer_size, arg_index, offset_type::COALESED_BUFFER);
@@ -65,7 +65,7 @@ namespace aiebu {
                                const uint32_t arg_index,
                                const boost::property_tree::ptree& pt)
   {
-    const uint32_t addend = get_32_bit_property(pt, "offset_in_bytes", true);
+    const uint64_t addend = get_64_bit_property(pt, "offset_in_bytes", true);
     const auto control_packet_patch_pt = pt.get_child_optional("control_packet_patch_locations");
     if (!control_packet_patch_pt)
       return;
@@ -140,7 +140,7 @@ namespace aiebu {
       validate_json(control_packet_offset, control_packet_size, arg_index, offset_type::CONTROL_PACKET);
       // move 8 bytes(header) up for unifying the patching scheme between DPU sequence and transaction-buffer
       uint32_t offset = control_packet_offset - 8;
-      const uint32_t addend = get_32_bit_property(patch, "bo_offset");
+      const uint64_t addend = get_64_bit_property(patch, "bo_offset");
 
       // TODO added symbols name hardcoded to ".pad.0" and col 0
       // this will change once compiler decide on how to generate multi col control packet design
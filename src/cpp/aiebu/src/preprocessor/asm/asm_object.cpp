@@ -0,0 +1,343 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <map>
+
+#include "asm/asm_object.h"
+#include "asm/asm_parser.h"
+#include "aiebu_error.h"
+
+namespace {
+
+class object_writer
+{
+  std::vector<char> m_body;
+  std::map<std::string, uint64_t, std::less<>> m_index;
+  std::vector<std::string_view> m_strings;
+
+  static void
+  write_uleb(std::vector<char>& out, uint64_t val)
+  {
+    do {
+      uint8_t byte = val & 0x7F;
+      val >>= 7;
+      if (val)
+        byte |= 0x80;
+      out.push_back(static_cast<char>(byte));
+    } while (val);
+  }
+
+public:
+  void uleb(uint64_t val) { write_uleb(m_body, val); }
+
+  void str(std::string_view val)
+  {
+    auto it = m_index.find(val);
+    if (it == m_index.end())
+    {
+      it = m_index.emplace(std::string(val), m_strings.size()).first;
+      m_strings.push_back(it->first);
+    }
+    uleb(it->second);
+  }
+
+  void bytes(const std::vector<char>& val)
+  {
+    uleb(val.size());
+    m_body.insert(m_body.end(), val.begin(), val.end());
+  }
+
+  std::vector<char> finish()
+  {
+    std::vector<char> out(std::begin(aiebu::asm_object_magic), std::end(aiebu::asm_object_magic));
+    write_uleb(out, aiebu::asm_object_version);
+    write_uleb(out, m_strings.size());
+    for (auto s : m_strings)
+    {
+      write_uleb(out, s.size());
+      out.insert(out.end(), s.begin(), s.end());
+    }
+    out.insert(out.end(), m_body.begin(), m_body.end());
+    return out;
+  }
+};
+
+class object_reader
+{
+  const uint8_t* m_cur;
+  const uint8_t* m_end;
+  std::vector<std::string> m_strings;
+
+  [[noreturn]] static void truncated()
+  {
+    throw aiebu::error(aiebu::error::error_code::invalid_asm, "Truncated aie2ps object !!!");
+  }
+
+public:
+  object_reader(const std::vector<char>& buffer)
+    : m_cur(reinterpret_cast<const uint8_t*>(buffer.data())), m_end(m_cur + buffer.size())
+  {
+    m_cur += sizeof(aiebu::asm_object_magic);
+    auto version = uleb();
+    if (version != aiebu::asm_object_version)
+      throw aiebu::error(aiebu::error::error_code::invalid_asm, "Unsupported aie2ps object version "
+                         + std::to_string(version) + " !!!");
+    auto strings = count();
+    m_strings.reserve(strings);
+    for (uint64_t i = 0; i < strings; ++i)
+    {
+      auto len = size();
+      m_strings.emplace_back(reinterpret_cast<const char*>(m_cur), len);
+      m_cur += len;
+    }
+  }
+
+  uint64_t uleb()
+  {
+    uint64_t val = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+    do {
+      if (m_cur == m_end || shift >= 64)
+        truncated();
+      byte = *m_cur++;
+      val |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    return val;
+  }
+
+  // a length that must fit in what is left of the buffer
+  size_t size()
+  {
+    auto len = uleb();
+    if (len > static_cast<uint64_t>(m_end - m_cur))
+      truncated();
+    return static_cast<size_t>(len);
+  }
+
+  // an element count, each element takes at least one byte of what is left,
+  // so a corrupt count fails here instead of sizing a huge allocation
+  size_t count()
+  {
+    return size();
+  }
+
+  const std::string& str()
+  {
+    auto idx = uleb();
+    if (idx >= m_strings.size())
+      throw aiebu::error(aiebu::error::error_code::invalid_asm, "Invalid string index in aie2ps object !!!");
+    return m_strings[idx];
+  }
+
+  std::vector<char> bytes()
+  {
+    auto len = size();
+    std::vector<char> val(m_cur, m_cur + len);
+    m_cur += len;
+    return val;
+  }
+
+  bool done() const { return m_cur == m_end; }
+};
+
+void
+write_tokens(object_writer& ow, const std::vector<aiebu::asm_data*>& tokens)
+{
+  ow.uleb(tokens.size());
+  for (auto& token : tokens)
+  {
+    auto op = token->get_operation();
+    ow.uleb(static_cast<uint64_t>(token->isLabel() ? aiebu::operation_type::label : aiebu::operation_type::op));
+    ow.str(op->get_name());
+    ow.str(token->get_file());
+    ow.uleb(token->get_linenumber());
+    ow.uleb(op->get_args().size());
+    for (auto& arg : op->get_args())
+      ow.str(arg);
+  }
+}
+
+void
+read_tokens(object_reader& rd, aiebu::asm_arena& arena, std::vector<aiebu::asm_data*>& tokens)
+{
+  auto count = rd.count();
+  tokens.reserve(tokens.size() + count);
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    auto type = rd.uleb();
+    if (type != static_cast<uint64_t>(aiebu::operation_type::label) &&
+        type != static_cast<uint64_t>(aiebu::operation_type::op))
+      throw aiebu::error(aiebu::error::error_code::invalid_asm, "Invalid token type in aie2ps object !!!");
+    auto& name = rd.str();
+    auto fileid = arena.intern_file(rd.str());
+    auto linenumber = static_cast<uint32_t>(rd.uleb());
+    auto nargs = rd.count();
+    std::vector<std::string_view> args;
+    args.reserve(nargs);
+    for (uint64_t a = 0; a < nargs; ++a)
+      args.push_back(rd.str());
+    tokens.emplace_back(arena.new_token(name, args, static_cast<aiebu::operation_type>(type),
+                                        linenumber, fileid));
+  }
+}
+
+}
+
+namespace aiebu {
+
+std::vector<char>
+asm_parser::
+write_object()
+{
+  object_writer ow;
+  auto cols = get_col_list();
+  std::sort(cols.begin(), cols.end());
+  ow.uleb(cols.size());
+  for (auto col : cols)
+  {
+    auto& coldata = m_col[col];
+    ow.uleb(col);
+    ow.uleb(coldata.get_label_data().size());
+    for (auto& [label, block] : coldata.get_label_data())
+    {
+      ow.str(label);
+      write_tokens(ow, block.text);
+      write_tokens(ow, block.data);
+    }
+    ow.uleb(coldata.get_labelpageindex().size());
+    for (auto& [label, index] : coldata.get_labelpageindex())
+    {
+      ow.str(label);
+      ow.uleb(index);
+    }
+    ow.uleb(coldata.get_scratchpads().size());
+    for (auto& [name, pad] : coldata.get_scratchpads())
+    {
+      ow.str(name);
+      ow.uleb(pad->get_size());
+      ow.bytes(pad->get_content());
+    }
+  }
+  return ow.finish();
+}
+
+void
+asm_parser::
+parse_object()
+{
+  object_reader rd(m_data);
+  auto cols = rd.count();
+  for (uint64_t c = 0; c < cols; ++c)
+  {
+    auto col = static_cast<uint32_t>(rd.uleb());
+    auto& coldata = m_col[col];
+    auto blocks = rd.count();
+    for (uint64_t b = 0; b < blocks; ++b)
+    {
+      auto& block = coldata.get_label_data()[rd.str()];
+      read_tokens(rd, *m_arena, block.text);
+      read_tokens(rd, *m_arena, block.data);
+    }
+    auto labels = rd.count();
+    for (uint64_t l = 0; l < labels; ++l)
+    {
+      std::string label = rd.str();
+      coldata.set_labelpageindex(label, static_cast<uint32_t>(rd.uleb()));
+    }
+    auto pads = rd.count();
+    for (uint64_t p = 0; p < pads; ++p)
+    {
+      std::string name = rd.str();
+      auto size = static_cast<offset_type>(rd.uleb());
+      auto content = rd.bytes();
+      coldata.set_scratchpad(name, size, content);
+    }
+  }
+  if (!rd.done())
+    throw error(error::error_code::invalid_asm, "Trailing bytes in aie2ps object !!!");
+}
+
+void
+asm_parser::
+link(asm_parser& unit)
+{
+  auto cols = unit.get_col_list();
+  std::sort(cols.begin(), cols.end());
+  for (auto col : cols)
+  {
+    auto& src = unit.m_col[col];
+    auto& dst = m_col[col];
+    for (auto& [label, block] : src.get_label_data())
+    {
+      auto it = dst.get_label_data().find(label);
+      if (it == dst.get_label_data().end())
+      {
+        dst.get_label_data().emplace(label, block);
+        continue;
+      }
+      // only the top level job stream of a column may span units, the
+      // dummy eof closing the previous unit's part is dropped
+      if (label.compare("default"))
+        throw error(error::error_code::invalid_asm, "Label block " + label + " of col " + std::to_string(col)
+                    + " defined in more than one unit !!!");
+      auto append = [](std::vector<asm_data*>& to, const std::vector<asm_data*>& from) {
+        if (from.empty())
+          return;
+        while (!to.empty() && !to.back()->isLabel() && !to.back()->get_operation()->get_name().compare("eof"))
+          to.pop_back();
+        to.insert(to.end(), from.begin(), from.end());
+      };
+      append(it->second.text, block.text);
+      append(it->second.data, block.data);
+    }
+
+    for (auto& [label, index] : src.get_labelpageindex())
+      dst.get_labelpageindex()[label] = index;
+
+    for (auto& [name, pad] : src.get_scratchpads())
+    {
+      auto it = dst.get_scratchpads().find(name);
+      if (it == dst.get_scratchpads().end())
+      {
+        dst.get_scratchpads().emplace(name, pad);
+        continue;
+      }
+      if (it->second->get_size() != pad->get_size() || it->second->get_content() != pad->get_content())
+        throw error(error::error_code::invalid_asm, "Scratchpad " + name + " of col " + std::to_string(col)
+                    + " differs between units !!!");
+    }
+  }
+
+  // the merged tokens point into the unit's arena
+  m_arena->link(unit.m_arena);
+}
+
+std::vector<char>
+write_asm_object(const std::vector<char>& buffer, const std::vector<std::string>& include_list)
+{
+  std::shared_ptr<asm_parser> parser(new asm_parser(buffer, include_list));
+  parser->parse_lines();
+  return parser->write_object();
+}
+
+std::vector<char>
+link_asm_objects(const std::vector<std::vector<char>>& units, const std::vector<std::string>& include_list)
+{
+  static const std::vector<char> empty;
+  std::shared_ptr<asm_parser> linked(new asm_parser(empty, include_list));
+  for (auto& unit : units)
+  {
+    std::shared_ptr<asm_parser> parser(new asm_parser(unit, include_list));
+    if (is_asm_object(unit))
+      parser->parse_object();
+    else
+      parser->parse_lines();
+    linked->link(*parser);
+  }
+  return linked->write_object();
+}
+
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#ifndef _AIEBU_PREPROCESSOR_ASM_ASM_OBJECT_H_
+#define _AIEBU_PREPROCESSOR_ASM_ASM_OBJECT_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace aiebu {
+
+// Binary aie2ps object, the parsed form of an asm program.
+//
+// It holds what asm_parser produces from the text: per column the label
+// blocks with their text and data tokens (includes expanded, directives
+// applied), the page labels and the scratchpads with their content. Label,
+// pad and symbol references stay symbolic in the token args and are
+// resolved when the object is assembled, exactly as for asm text. An
+// object is accepted wherever aie2ps asm is, it is recognized by its magic.
+//
+// All integers are ULEB128, strings are indices into the string table:
+//
+//   magic[8]         ; asm_object_magic
+//   uleb version     ; asm_object_version
+//   uleb string_count
+//   string_count x { uleb length, bytes }
+//   uleb col_count
+//   col_count x {
+//     uleb col
+//     uleb block_count
+//     block_count x {
+//       uleb label
+//       uleb text_count, text_count x token
+//       uleb data_count, data_count x token
+//     }
+//     uleb page_label_count
+//     page_label_count x { uleb label, uleb page_index }
+//     uleb pad_count
+//     pad_count x { uleb name, uleb size, uleb content_size, content bytes }
+//   }
+//
+//   token = { uleb optype, uleb name, uleb file, uleb linenumber,
+//             uleb arg_count, arg_count x uleb arg }
+constexpr char asm_object_magic[8] = {'\x7f', 'A', 'I', 'E', 'B', 'U', 'O', 'B'};
+constexpr uint32_t asm_object_version = 1;
+
+inline bool
+is_asm_object(const std::vector<char>& buffer)
+{
+  return buffer.size() >= sizeof(asm_object_magic) &&
+         !std::memcmp(buffer.data(), asm_object_magic, sizeof(asm_object_magic));
+}
+
+// Parse aie2ps asm text, .include and .setpad files are looked up in
+// 'include_list', and return it as an object
+std::vector<char>
+write_asm_object(const std::vector<char>& buffer, const std::vector<std::string>& include_list);
+
+// Link independently parsed units, each asm text or an object, into one
+// object. Columns are merged; a column's top level job stream is
+// concatenated in unit order, its other label blocks must be unique. Label
+// references are resolved across units once the result is assembled, the
+// same as if all units had been one asm. Pages are numbered and scratchpads
+// laid out when the linked object is assembled.
+std::vector<char>
+link_asm_objects(const std::vector<std::vector<char>>& units, const std::vector<std::string>& include_list);
+
+}
+#endif //_AIEBU_PREPROCESSOR_ASM_ASM_OBJECT_H_
@@ -8,7 +8,7 @@ namespace aiebu {
 
 void
 asm_parser::
-insert_col_asmdata(std::shared_ptr<asm_data> data)
+insert_col_asmdata(asm_data* data)
 {
   // insert asm_data in col list
   if (m_current_col == -1)
@@ -76,98 +76,72 @@ parse_lines()
   directive_list[".endl"] = std::make_shared<end_of_label_directive>();
   directive_list[".setpad"] = std::make_shared<pad_directive>();
   directive_list[".section"] = std::make_shared<section_directive>();
-  std::string file = "default";
-  parse_lines(m_data, file);
+  parse_lines(std::string_view(m_data.data(), m_data.size()), "default");
 }
 
 void
 asm_parser::
-parse_lines(const std::vector<char>& data, std::string& file)
+parse_lines(std::string_view data, const std::string& file)
 {
-  //parse asm code
-  const std::regex COMMENT_REGEX("^;(.*)$");
-  const std::regex LABEL_REGEX("^([a-zA-Z0-9_]+)\\:$");
-  const std::regex OP_REGEX("^([.a-zA-Z0-9_]+)(?:\\s+(.+)+)?$");
-  const std::regex DIRCETIVE_REGEX(".^([a-zA-Z0-9_]+)(?:\\s+(.+)+)?$");
-
-  std::string str(data.begin(), data.end());
-  std::istringstream isstr(str);
-  std::string line;
-  uint32_t linenumber = 0;
-
-  while (std::getline(isstr, line)) {
-    line = trim(line);
-    if(line.empty())
-      continue;
-
-    if (std::regex_match(line, COMMENT_REGEX))
-      continue;
+  parse_lexed(lex_source(data), file);
+}
 
-    std::smatch sm;
+void
+asm_parser::
+parse_lexed(const std::vector<asm_lexed_line>& lines, const std::string& file)
+{
+  //parse asm code, lines and tokens are views into the source
+  auto fileid = m_arena->intern_file(file);
+  for (const auto& lexed : lines) {
+    const auto& tokens = lexed.tokens;
 
     // Check for Directive
-    std::regex_match(line, sm, DIRCETIVE_REGEX);
-    if (operate_directive(line))
-    {
-      ++linenumber;
-
-//      std::regex_match(line, sm, OP_REGEX);
-//      m_current_col = std::stoi(sm[2].str());
-      // Initialize empty m_col, it helps when .attach_to_group is immediately followed
-      // by another .attach_to_group. This use case is relevant for aie2asm flow where
-      // this directive is used to determine column range for a ctrlcode
-//      m_col[m_current_col] = std::vector<std::shared_ptr<asm_data>>();
+    if (lexed.is_op && operate_directive(tokens))
       continue;
-    }
 
     // check for label
-    std::regex_match(line, sm, LABEL_REGEX);
-    if (sm.size())
+    if (lexed.is_label)
     {
       if (!get_data_state())
-        m_current_label = m_current_label + ":" + sm[1].str();
+        m_current_label = m_current_label + ":" + std::string(lexed.label);
       else
-        insert_col_asmdata(std::make_shared<asm_data>(std::make_shared<operation>(sm[1].str(), ""),
-                                                      operation_type::label, code_section::unknown, 0,
-                                                      (uint32_t)-1, linenumber, line, file));
+        insert_col_asmdata(m_arena->new_token(lexed.label, "", operation_type::label,
+                                              lexed.linenumber, fileid));
     }
     // check for operation
-    std::regex_match(line, sm, OP_REGEX);
-    if (sm.size())
+    if (lexed.is_op)
     {
-      insert_col_asmdata(std::make_shared<asm_data>(std::make_shared<operation>(sm[1].str(), sm[2].str()),
-                                                    operation_type::op, code_section::unknown, 0, (uint32_t)-1,
-                                                    linenumber, line, file));
-      if (!sm[1].str().compare("EOF"))
+      insert_col_asmdata(m_arena->new_token(tokens.name, tokens.args, operation_type::op,
+                                            lexed.linenumber, fileid));
+      if (tokens.name == "EOF")
         set_data_state(true);
     }
-    ++linenumber;
   }
 
 }
 
 void
 attach_to_group_directive::
-operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
+operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens)
 {
   m_parserptr = parserptr;
-  if (sm.size() < 3)
+  if (tokens.args.empty())
     throw error(error::error_code::invalid_asm, "Invalid attach_to_group directive argument\n");
 
   // dummy eof added if col change happens before eof
-  m_parserptr->insert_col_asmdata(std::make_shared<asm_data>(std::make_shared<operation>("eof", ""),
-                                                    operation_type::op, code_section::unknown, 0, (uint32_t)-1,
-                                                    0, "eof", "default"));
-  m_parserptr->set_current_col(std::stoi(sm[2].str()));
+  auto& arena = m_parserptr->get_arena();
+  m_parserptr->insert_col_asmdata(arena.new_token("eof", "", operation_type::op, 0,
+                                                  arena.intern_file("default")));
+  m_parserptr->set_current_col(std::stoi(std::string(tokens.args)));
   m_parserptr->set_data_state(false);
 }
 
 void
 section_directive::
-operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
+operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens)
 {
   m_parserptr = parserptr;
-  std::vector<std::string> args = splitoption(sm[2].str().c_str(), ',');
+  std::vector<std::string> args = splitoption(std::string(tokens.args).c_str(), ',');
   if (is_test_section(args[0]))
     m_parserptr->set_data_state(false);
   else if (is_data_section(args[0]))
@@ -180,28 +154,24 @@ bool
 include_directive::
 read_include_file(std::string filename)
 {
-  std::ifstream file(filename);
-  if (!file.is_open()) {
+  auto lexed = m_parserptr->get_include_cache().get(filename);
+  if (!lexed)
     return false;
-  }
+
   std::cout << "Reading file:" << filename << std::endl;
-  std::string line;
   m_parserptr->set_data_state(false);
-
-  auto data = std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-  m_parserptr->parse_lines(data, filename);
-  file.close();
+  m_parserptr->parse_lexed(lexed->lines, filename);
   m_parserptr->pop_data_state();
   return true;
 }
 
 void
 include_directive::
-operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
+operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens)
 {
   m_parserptr = parserptr;
-  //std::vector<std::string> args = splitoption(sm[2].str().c_str(), ',');
-  std::string file = sm[2].str();//args[0];
+  //std::vector<std::string> args = splitoption(tokens.args.c_str(), ',');
+  std::string file(tokens.args);
   if (file.size() >= 2 && file.front() == '"' && file.back() == '"')
     file =  file.substr(1, file.size() - 2);
 
@@ -224,24 +194,24 @@ operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
 
 void
 end_of_label_directive::
-operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
+operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens)
 {
   m_parserptr = parserptr;
 
   std::string label = m_parserptr->top_label();
   m_parserptr->pop_label();
 
-  std::vector<std::string> args = splitoption(sm[2].str().c_str(), ',');
+  std::vector<std::string> args = splitoption(std::string(tokens.args).c_str(), ',');
   if (label.compare(args[0]))
     throw error(error::error_code::internal_error, "endl label missmatch (" + label + " != " + args[0] + ")\n");
 }
 
 void
 pad_directive::
-operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm)
+operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens)
 {
   m_parserptr = parserptr;
-  std::vector<std::string> args = splitoption(sm[2].str().c_str(), ',');
+  std::vector<std::string> args = splitoption(std::string(tokens.args).c_str(), ',');
 
   add_scratchpad(args[0], args[1]);
 }
@@ -257,8 +227,7 @@ add_scratchpad(std::string& name, std::string& str) {
     return;
   }
   // Check if the string is a hexadecimal number
-  std::regex hex_regex("0[xX][0-9a-fA-F]+");
-  if (std::regex_match(str, hex_regex)) {
+  if (is_hex_number(str)) {
     std::vector<char> empty_vector;
     m_parserptr->insert_scratchpad(name, convert2int(str) * WORD_SIZE, empty_vector);
     return;
@@ -290,18 +259,16 @@ bool
 pad_directive::
 read_pad_file(std::string& name, std::string& filename)
 {
-  std::ifstream file(filename, std::ios::in | std::ios::binary);
-  if (!file.is_open()) {
+  auto source = mapped_file::open(filename);
+  if (!source)
     return false;
-  }
 
   std::cout << "Reading file:" << filename << std::endl;
-  std::string line;
   m_parserptr->set_data_state(false);
 
-  auto data = std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  // scratchpad keeps its own copy of the content
+  std::vector<char> data(source->data(), source->data() + source->size());
   m_parserptr->insert_scratchpad(name, data.size(), data);
-  file.close();
   return true;
 }
 }
@@ -4,27 +4,34 @@
 #ifndef _AIEBU_PREPROCESSOR_ASM_ASM_PARSER_H_
 #define _AIEBU_PREPROCESSOR_ASM_ASM_PARSER_H_
 
+#include <algorithm>
+#include <deque>
+#include <set>
+#include <type_traits>
+#include <mutex>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <stack>
-#include <regex>
 #include <map>
 #include <unordered_map>
 #include "utils.h"
 #include "code_section.h"
+#include "mapped_file.h"
+#include "operand.h"
 
 namespace aiebu {
 
-inline std::string trim(const std::string& line)
+inline std::string_view trim(std::string_view line)
 {
     // trim the last
-    std::string WhiteSpace = " \t\f\v\n\r";
+    constexpr std::string_view WhiteSpace = " \t\f\v\n\r";
     std::size_t start = line.find_first_not_of(WhiteSpace);
     std::size_t end = line.find_last_not_of(WhiteSpace);
-    return start == end ? std::string() : line.substr(start, end - start + 1);
+    return start == end ? std::string_view() : line.substr(start, end - start + 1);
 }
 
 enum class operation_type: uint8_t
@@ -33,32 +40,182 @@ enum class operation_type: uint8_t
   op = 2,
 };
 
-// Start defining regexs required for parsing aie2asm
+// Hand written lexer for asm lines, the grammar is small enough that
+// std::regex only added cost. All helpers expect an already trimmed line
+// and return views into it, nothing is copied until an operation is built.
 
-const std::string HEX_RE("[[:space:]]*(0[xX][[:xdigit:]]+)[[:space:]]*");
-const std::string L_BRACK_RE("[[:space:]]*\\([[:space:]]*");
-const std::string R_BRACK_RE("[[:space:]]*\\)[[:space:]]*");
+inline bool is_space_char(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+inline bool is_ident_char(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+inline bool is_hex_char(char c)
+{
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// "; anything"
+inline bool is_comment(std::string_view line)
+{
+  return !line.empty() && line[0] == ';';
+}
+
+// "0x1F" or "0X1f"
+inline bool is_hex_number(std::string_view str)
+{
+  if (str.size() < 3 || str[0] != '0' || (str[1] != 'x' && str[1] != 'X'))
+    return false;
+  return std::all_of(str.begin() + 2, str.end(), is_hex_char);
+}
+
+// "<name>:" where name is [a-zA-Z0-9_]+, returns the name
+inline bool lex_label(std::string_view line, std::string_view& name)
+{
+  if (line.size() < 2 || line.back() != ':')
+    return false;
+  if (!std::all_of(line.begin(), line.end() - 1, is_ident_char))
+    return false;
+  name = line.substr(0, line.size() - 1);
+  return true;
+}
+
+// Operation or directive: "<name>" or "<name><whitespace><args>" where
+// name is [.a-zA-Z0-9_]+ and args is the rest of the line
+struct asm_tokens
+{
+  std::string_view name;
+  std::string_view args;
+};
+
+inline bool lex_operation(std::string_view line, asm_tokens& tokens)
+{
+  std::size_t pos = 0;
+  while (pos < line.size() && (is_ident_char(line[pos]) || line[pos] == '.'))
+    ++pos;
+  if (pos == 0)
+    return false;
+
+  std::size_t name_end = pos;
+  if (pos < line.size()) {
+    if (!is_space_char(line[pos]))
+      return false;
+    while (pos < line.size() && is_space_char(line[pos]))
+      ++pos;
+    // args run to the end of the line and never span a line break
+    if (pos == line.size() || line.find_first_of("\r\n", pos) != std::string_view::npos)
+      return false;
+  }
+  tokens.name = line.substr(0, name_end);
+  tokens.args = line.substr(pos);
+  return true;
+}
 
 class operation
 {
-  std::string m_name;
-  std::vector<std::string> m_args;
-public:
+  // lowercased and interned, see asm_arena::intern_name()
+  const std::string* m_name;
+  // lowercased arg text, views into the asm_arena
+  std::vector<std::string_view> m_args;
+  // m_args decoded once, same index
+  std::vector<operand> m_operands;
 
-  operation(const std::string& name, std::string sargs): m_name(name)
+public:
+  operation(const std::string* name, std::vector<std::string_view> args): m_name(name), m_args(std::move(args))
   {
-    std::transform(m_name.begin(), m_name.end(), m_name.begin(), ::tolower);
-    std::transform(sargs.begin(), sargs.end(), sargs.begin(), ::tolower);
+    m_operands.reserve(m_args.size());
+    for (auto arg : m_args)
+      m_operands.push_back(operand::classify(arg));
+  }
 
-    std::string s;
-    std::stringstream ss(sargs);
-    while (std::getline(ss, s, ' ')) {
-        m_args.emplace_back(s.substr(0, s.find_last_not_of(",")+1));
-    }
+  const std::string& get_name() const { return *m_name; }
+  const std::vector<std::string_view>& get_args() const { return m_args; }
+  const std::vector<operand>& get_operands() const { return m_operands; }
+  void set_ref(size_t argi, refid_type id) { m_operands[argi].set_ref(id); }
+  void resolve_ref(size_t argi, bool pad, uint32_t label) { m_operands[argi].resolve(pad, label); }
+};
+
+// One lexed line, empty and comment lines are dropped. linenumber counts
+// the remaining lines, as reported in diagnostics.
+struct asm_lexed_line
+{
+  asm_tokens tokens;
+  std::string_view label;
+  uint32_t linenumber;
+  bool is_op;
+  bool is_label;
+};
+
+// Lexing does not depend on parser state, so a lexed source can be replayed
+// wherever it is included. The views point into 'text'.
+struct asm_lexed_source
+{
+  std::string text;
+  std::vector<asm_lexed_line> lines;
+};
+
+inline std::vector<asm_lexed_line> lex_source(std::string_view data)
+{
+  std::vector<asm_lexed_line> lines;
+  uint32_t linenumber = 0;
+  std::size_t next = 0;
+  while (next < data.size()) {
+    std::size_t eol = data.find('\n', next);
+    if (eol == std::string_view::npos)
+      eol = data.size();
+    std::string_view line = trim(data.substr(next, eol - next));
+    next = eol + 1;
+    if (line.empty() || is_comment(line))
+      continue;
+
+    asm_lexed_line lexed{{}, {}, linenumber++, false, false};
+    lexed.is_op = lex_operation(line, lexed.tokens);
+    lexed.is_label = lex_label(line, lexed.label);
+    lines.emplace_back(lexed);
   }
+  return lines;
+}
 
-  const std::string& get_name() const { return m_name; }
-  const std::vector<std::string>& get_args() const { return m_args; }
+// Cache of lexed include files keyed by path. An entry owns a copy of the
+// file and is reused while the file has the same content, a file rewritten
+// in place within the timestamp resolution of the file system is still
+// lexed again. Each assembly gets its own cache unless the "include_cache"
+// flag selects the process wide one.
+class include_cache
+{
+  std::mutex m_mutex;
+  std::map<std::string, std::shared_ptr<const asm_lexed_source>> m_entries;
+
+public:
+  // returns nullptr if the file can not be opened
+  std::shared_ptr<const asm_lexed_source> get(const std::string& filename)
+  {
+    // only mapped while it is compared or copied
+    auto source = mapped_file::open(filename);
+    if (!source)
+      return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(filename);
+    if (it != m_entries.end() && it->second->text == source->view())
+      return it->second;
+
+    auto lexed = std::make_shared<asm_lexed_source>();
+    lexed->text.assign(source->view());
+    lexed->lines = lex_source(lexed->text);
+    m_entries[filename] = lexed;
+    return lexed;
+  }
+
+  static std::shared_ptr<include_cache> session()
+  {
+    static auto cache = std::make_shared<include_cache>();
+    return cache;
+  }
 };
 
 class asm_parser;
@@ -68,14 +225,14 @@ public:
   std::shared_ptr<asm_parser> m_parserptr;
 public:
   directive() {}
-  virtual void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm) = 0;
+  virtual void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens) = 0;
 };
 
 class attach_to_group_directive: public directive
 {
 public:
   attach_to_group_directive() {}
-  void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm);
+  void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens);
 };
 
 class include_directive: public directive
@@ -100,14 +257,14 @@ class include_directive: public directive
   }
 public:
   include_directive() {}
-  void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm);
+  void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens);
 };
 
 class end_of_label_directive: public directive
 {
 public:
   end_of_label_directive() {}
-  void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm);
+  void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens);
 };
 
 class pad_directive: public directive
@@ -149,7 +306,7 @@ public:
   }
   void add_scratchpad(std::string& name, std::string& str);
   pad_directive() {}
-  void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm);
+  void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens);
 };
 
 class section_directive: public directive
@@ -158,56 +315,182 @@ class section_directive: public directive
   bool is_data_section(const std::string& str) {return !str.substr(0,9).compare(".ctrldata"); }
 public:
   section_directive() {}
-  void operate(std::shared_ptr<asm_parser> parserptr, const std::smatch& sm);
+  void operate(std::shared_ptr<asm_parser> parserptr, const asm_tokens& tokens);
 };
 
+// One asm token. Trivially copyable, it only points at its operation and
+// the interned file name, both owned by the asm_arena. Tokens are passed
+// around as plain pointers, the arena outlives everything using them.
 class asm_data
 {
-  std::shared_ptr<operation> m_op;
+  operation* m_op;
   operation_type m_optype;
   code_section m_section;
   uint64_t m_size;
   pageid_type m_pagenum;
   uint32_t m_linenumber;
-  std::string m_line;
-  std::string m_file;
+  uint32_t m_fileid;
+  // labels only
+  refid_type m_ref;
+  const std::string* m_file;
 
 public:
   asm_data() = default;
-  asm_data(std::shared_ptr<operation> op, operation_type optype,
+  asm_data(operation* op, operation_type optype,
            code_section sec, uint64_t size, uint32_t pgnum,
-           uint32_t ln, std::string line, std::string file)
+           uint32_t ln, uint32_t fileid, const std::string* file, refid_type ref = NO_REF)
            :m_op(op), m_optype(optype), m_section(sec), m_size(size),
-            m_pagenum(pgnum), m_linenumber(ln), m_line(line), m_file(file) {}
-
-  asm_data( asm_data* a)
-  {
-    a->m_op = m_op;
-    a->m_optype = m_optype;
-    a->m_section = m_section;
-    a->m_size = m_size;
-    a->m_pagenum = m_pagenum;
-    a->m_linenumber = m_linenumber;
-    a->m_line = m_line;
-    a->m_file = m_file;
-  }
+            m_pagenum(pgnum), m_linenumber(ln), m_fileid(fileid), m_ref(ref), m_file(file) {}
 
   HEADER_ACCESS_GET_SET(code_section, section);
   HEADER_ACCESS_GET_SET(uint64_t, size);
   HEADER_ACCESS_GET_SET(pageid_type, pagenum);
   HEADER_ACCESS_GET_SET(uint32_t, linenumber);
-  HEADER_ACCESS_GET_SET(std::string, file);
-  bool isLabel() { return m_optype == operation_type::label; }
-  bool isOpcode() { return m_optype == operation_type::op; }
-  std::shared_ptr<operation> get_operation() { return m_op; }
+  uint32_t get_fileid() const { return m_fileid; }
+  const std::string& get_file() const { return *m_file; }
+  refid_type get_ref() const { return m_ref; }
+  bool isLabel() const { return m_optype == operation_type::label; }
+  bool isOpcode() const { return m_optype == operation_type::op; }
+  operation* get_operation() const { return m_op; }
+
+};
+
+static_assert(std::is_trivially_copyable_v<asm_data>, "asm_data must stay trivially copyable");
+
+// Storage for the tokens of one parse. Tokens and operations are allocated
+// from deques and arg text from blocks, so addresses are stable and
+// allocation is per block instead of per line. Mnemonics, file names and
+// label references are interned. The arena is kept alive by whatever holds
+// its tokens, see aie2ps_preprocessed_output::set_arena().
+class asm_arena
+{
+  constexpr static size_t TEXT_BLOCK_SIZE = 64 * 1024;
+
+  std::deque<operation> m_ops;
+  std::deque<asm_data> m_tokens;
+  std::set<std::string, std::less<>> m_names;
+  std::deque<std::string> m_files;
+  std::map<std::string, uint32_t, std::less<>> m_fileids;
+  std::deque<std::string> m_refs;
+  std::unordered_map<std::string_view, refid_type> m_refids;
+  std::vector<std::unique_ptr<char[]>> m_text;
+  char* m_textpos = nullptr;
+  size_t m_textfree = 0;
+  // arenas of linked units, their tokens are merged into this parse
+  std::vector<std::shared_ptr<const asm_arena>> m_linked;
+  std::string m_scratch;
+
+  // lowercased copy of 'text'
+  std::string_view store_lower(std::string_view text)
+  {
+    if (text.size() > m_textfree)
+    {
+      m_textfree = std::max(TEXT_BLOCK_SIZE, text.size());
+      m_text.emplace_back(new char[m_textfree]);
+      m_textpos = m_text.back().get();
+    }
+    std::transform(text.begin(), text.end(), m_textpos, ::tolower);
+    std::string_view stored(m_textpos, text.size());
+    m_textpos += text.size();
+    m_textfree -= text.size();
+    return stored;
+  }
+
+  asm_data*
+  add_token(operation& op, operation_type optype, uint32_t ln, uint32_t fileid)
+  {
+    const auto& args = op.get_args();
+    for (size_t argi = 0; argi < args.size(); ++argi)
+      if (op.get_operands()[argi].is_ref())
+        op.set_ref(argi, intern_ref(fileid, args[argi].substr(1)));
+    auto ref = (optype == operation_type::label) ? intern_ref(fileid, op.get_name()) : NO_REF;
+    return &m_tokens.emplace_back(&op, optype, code_section::unknown, 0, (uint32_t)-1,
+                                  ln, fileid, &m_files[fileid], ref);
+  }
+
+public:
+  // lowercase and intern an operation or label name
+  const std::string* intern_name(std::string_view name)
+  {
+    m_scratch.assign(name);
+    std::transform(m_scratch.begin(), m_scratch.end(), m_scratch.begin(), ::tolower);
+    auto it = m_names.find(m_scratch);
+    if (it == m_names.end())
+      it = m_names.emplace(m_scratch).first;
+    return &*it;
+  }
+
+  uint32_t intern_file(std::string_view file)
+  {
+    auto it = m_fileids.find(file);
+    if (it != m_fileids.end())
+      return it->second;
+    auto id = static_cast<uint32_t>(m_files.size());
+    m_files.emplace_back(file);
+    m_fileids.emplace(std::string(file), id);
+    return id;
+  }
+
+  const std::string& get_file(uint32_t id) const { return m_files.at(id); }
+
+  // A label and the references to it from the same file get the same id,
+  // names are already lowercased
+  refid_type intern_ref(uint32_t fileid, std::string_view name)
+  {
+    m_scratch.assign(m_files[fileid]);
+    m_scratch += ':';
+    m_scratch += name;
+    auto it = m_refids.find(m_scratch);
+    if (it != m_refids.end())
+      return it->second;
+    auto id = static_cast<refid_type>(m_refs.size());
+    m_refids.emplace(m_refs.emplace_back(m_scratch), id);
+    return id;
+  }
+
+  // "<file>:<name>" of a label or reference
+  const std::string& get_ref(refid_type id) const { return m_refs.at(id); }
+
+  // 'args' is the operation's arg text as in the asm
+  asm_data*
+  new_token(std::string_view name, std::string_view args, operation_type optype,
+            uint32_t ln, uint32_t fileid)
+  {
+    // split on ' ' dropping trailing ',', same as getline(ss, s, ' ')
+    auto text = store_lower(args);
+    std::vector<std::string_view> views;
+    std::size_t start = 0;
+    while (start < text.size()) {
+      std::size_t end = text.find(' ', start);
+      if (end == std::string_view::npos)
+        end = text.size();
+      auto arg = text.substr(start, end - start);
+      views.push_back(arg.substr(0, arg.find_last_not_of(",") + 1));
+      start = end + 1;
+    }
+    return add_token(m_ops.emplace_back(intern_name(name), std::move(views)), optype, ln, fileid);
+  }
+
+  // already split and lowercased args, see asm_parser::parse_object()
+  asm_data*
+  new_token(std::string_view name, const std::vector<std::string_view>& args, operation_type optype,
+            uint32_t ln, uint32_t fileid)
+  {
+    std::vector<std::string_view> views;
+    views.reserve(args.size());
+    for (auto arg : args)
+      views.push_back(store_lower(arg));
+    return add_token(m_ops.emplace_back(intern_name(name), std::move(views)), optype, ln, fileid);
+  }
 
+  void link(std::shared_ptr<const asm_arena> unit) { m_linked.emplace_back(std::move(unit)); }
 };
 
 class section_asmdata
 {
 public:
-  std::vector<std::shared_ptr<asm_data>> text;
-  std::vector<std::shared_ptr<asm_data>> data;
+  std::vector<asm_data*> text;
+  std::vector<asm_data*> data;
 };
 
 class scratchpad_info
@@ -240,9 +523,9 @@ class col_data
   std::map<std::string, std::shared_ptr<scratchpad_info>> m_scratchpads;
 public:
 
-  std::vector<std::shared_ptr<asm_data>> get_label_asmdata(const std::string& label)
+  std::vector<asm_data*> get_label_asmdata(const std::string& label)
   {
-    std::vector<std::shared_ptr<asm_data>> result(m_label_data[label].text);
+    std::vector<asm_data*> result(m_label_data[label].text);
     result.insert(result.end(), m_label_data[label].data.begin(), m_label_data[label].data.end());
     return result;
   }
@@ -270,11 +553,13 @@ class asm_parser: public std::enable_shared_from_this<asm_parser>
 {
   std::unordered_map<uint32_t, col_data> m_col;
   const std::vector<char> &m_data;
-  std::map<std::string, std::shared_ptr<directive>> directive_list;
+  std::map<std::string, std::shared_ptr<directive>, std::less<>> directive_list;
   std::stack<bool> isdatastack;
   std::string m_current_label = "default";
   int m_current_col = -1;
   const std::vector<std::string>& m_include_list;
+  std::shared_ptr<include_cache> m_include_cache = std::make_shared<include_cache>();
+  std::shared_ptr<asm_arena> m_arena = std::make_shared<asm_arena>();
 
 public:
   asm_parser(const std::vector<char>& data, const std::vector<std::string>& include_list):m_data(data), m_include_list(include_list)
@@ -311,7 +596,7 @@ public:
 
   void set_current_label(std::string& label) { m_current_label = label; }
 
-  void insert_col_asmdata(std::shared_ptr<asm_data> data);
+  void insert_col_asmdata(asm_data* data);
 
   std::vector<uint32_t> get_col_list();
 
@@ -319,7 +604,27 @@ public:
 
   void parse_lines();
 
-  void parse_lines(const std::vector<char>& data, std::string& file);
+  void parse_lines(std::string_view data, const std::string& file);
+
+  void parse_lexed(const std::vector<asm_lexed_line>& lines, const std::string& file);
+
+  // input is a binary object (see asm_object.h) instead of asm text
+  void parse_object();
+
+  // serialize the parsed columns, see asm_object.h
+  std::vector<char> write_object();
+
+  // merge the columns of another parsed unit, see link_asm_objects()
+  void link(asm_parser& unit);
+
+  void set_include_cache(std::shared_ptr<include_cache> cache) { m_include_cache = std::move(cache); }
+
+  include_cache& get_include_cache() { return *m_include_cache; }
+
+  asm_arena& get_arena() { return *m_arena; }
+
+  // the tokens of this parse live as long as the arena
+  std::shared_ptr<const asm_arena> share_arena() const { return m_arena; }
 
   void set_current_col(int col) { m_current_col = col;
     m_col[m_current_col] = col_data();
@@ -340,18 +645,13 @@ public:
 
   std::map<std::string, std::shared_ptr<scratchpad_info>>& getcolscratchpad(int col) { return m_col[col].get_scratchpads(); }
 
-  bool operate_directive(std::string& line)
+  bool operate_directive(const asm_tokens& tokens)
   {
-    std::smatch sm;
-    std::regex DIRCETIVE_REGEX("^([.a-zA-Z0-9_]+)(?:\\s+(.+)+)?$");
-    std::regex_match(line, sm, DIRCETIVE_REGEX);
-    if (sm.size() == 0)
-      return false;
-
-    if (directive_list.count(sm[1].str()) == 0)
+    auto it = directive_list.find(tokens.name);
+    if (it == directive_list.end())
       return false;
 
-    directive_list[sm[1].str()]->operate(shared_from_this(), sm);
+    it->second->operate(shared_from_this(), tokens);
     return true;
   }
 };
@@ -5,6 +5,7 @@
 #define _AIEBU_PREPROCESSOR_ASM_PAGE_H_
 
 #include "asm/asm_parser.h"
+#include "aiebu_assembler.h"
 
 namespace aiebu {
 
@@ -18,14 +19,19 @@ class page
   uint32_t m_ooo_order_page_len_1;
   uint32_t m_ooo_order_page_len_2;
   std::vector<std::string> m_externallabels;
+  // page index and length of every out of order page, only for pages with
+  // more targets than the header has slots for
+  std::vector<std::pair<uint32_t, uint32_t>> m_ooo_table;
+  // how the pager filled the page
+  page_report::page_info m_info;
 
 public:
-  std::vector<std::shared_ptr<asm_data>> m_text;
-  std::vector<std::shared_ptr<asm_data>> m_data;
+  std::vector<asm_data*> m_text;
+  std::vector<asm_data*> m_data;
 
   page() {}
-  page(uint32_t colnum, uint32_t pagenum, std::vector<std::shared_ptr<asm_data>> text,
-       std::vector<std::shared_ptr<asm_data>> data, bool islastpage, uint32_t cur_len, uint32_t in_order_len, std::vector<std::string> externallabels)
+  page(uint32_t colnum, uint32_t pagenum, std::vector<asm_data*> text,
+       std::vector<asm_data*> data, bool islastpage, uint32_t cur_len, uint32_t in_order_len, std::vector<std::string> externallabels)
        : m_colnum(colnum), m_pagenum(pagenum), m_islastpage(islastpage), m_cur_page_len(cur_len), m_in_order_page_len(in_order_len),
          m_ooo_order_page_len_1(0), m_ooo_order_page_len_2(0), m_externallabels(externallabels), m_text(text), m_data(data) { }
 
@@ -43,7 +49,10 @@ public:
   std::vector<std::string>& getout_of_order_page() { return m_externallabels;}
   uint32_t get_ooo_page_len_1() { return m_ooo_order_page_len_1;}
   uint32_t get_ooo_page_len_2() { return m_ooo_order_page_len_2;}
+  void set_ooo_table(std::vector<std::pair<uint32_t, uint32_t>> table) { m_ooo_table = std::move(table); }
+  const std::vector<std::pair<uint32_t, uint32_t>>& get_ooo_table() const { return m_ooo_table; }
   HEADER_ACCESS_GET_SET(std::vector<std::string>, externallabels);
+  HEADER_ACCESS_GET_SET(page_report::page_info, info);
 };
 
 }
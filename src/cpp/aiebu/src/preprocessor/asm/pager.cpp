@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: MIT
 // Copyright (C) 2024, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <algorithm>
+#include <numeric>
 #include <unordered_set>
 #include "asm/pager.h"
 #include "aiebu_error.h"
@@ -8,31 +10,6 @@
 
 namespace aiebu {
 
-template <typename T>
-std::vector<T>
-pager::
-union_of_lists_inorder(std::vector<T>& vec1, std::vector<T>& vec2)
-{
-  // order of insertion is important
-  std::unordered_set<T> seen;
-  std::vector<T> vec3;
-
-  // Insert elements from the first vector
-  for (const auto& str : vec1) {
-    if (seen.insert(str).second) {
-      vec3.push_back(str);
-    }
-  }
-
-  // Insert elements from the second vector
-  for (const auto& str : vec2) {
-    if (seen.insert(str).second) {
-      vec3.push_back(str);
-    }
-  }
-  return vec3;
-}
-
 offset_type
 pager::
 datasectionaligner(offset_type size)
@@ -44,159 +21,319 @@ datasectionaligner(offset_type size)
 
 offset_type
 pager::
-getdatasectionsize(assembler_state& state, std::vector<std::string>& labels_list)
+getdatasectionsize(assembler_state& state, std::vector<labelidx_type>& labels_list,
+                   std::vector<uint32_t>& contents)
 {
   // get data section size for label list
   offset_type dsize16 = 0;
   offset_type dsize4 = 0;
-  for (auto &lb : labels_list)
+  std::unordered_set<uint32_t> seen;
+  contents.clear();
+  for (auto lb : labels_list)
   {
-    auto token = state.m_data[state.m_labelmap[lb]->get_index() + 1];
+    if (m_dedup_data)
+    {
+      auto content = labelcontent(state, lb);
+      if (!seen.insert(content).second)
+        continue;
+      contents.push_back(content);
+    }
+    auto& plabel = state.m_labels[lb];
+    auto token = state.m_data[plabel.get_index() + 1];
     auto &name = token->get_operation()->get_name();
     if (ALIGNMAP.count(name) > 0)
     {
       if (ALIGNMENT_16 == ALIGNMAP.at(name))
-        dsize16 += state.m_labelmap[lb]->get_size();
+        dsize16 += plabel.get_size();
       else if (ALIGNMENT_4 == ALIGNMAP.at(name))
-        dsize4 += state.m_labelmap[lb]->get_size();
+        dsize4 += plabel.get_size();
       else
         throw error(error::error_code::internal_error, name +" found in ALIGNMAP with allignment " + std::to_string(ALIGNMAP.at(name)));
     }
     else
-      throw error(error::error_code::internal_error, lb +" not found in ALIGNMAP!!!");
+      throw error(error::error_code::internal_error, plabel.get_name() +" not found in ALIGNMAP!!!");
   }
   return dsize4 + dsize16;
 }
 
-std::vector<jobid_type>
+uint32_t
+pager::
+labelcontent(assembler_state& state, labelidx_type lb)
+{
+  if (m_labelcontent[lb] != NO_INDEX && m_labelcontent[lb] != CONTENT_BUILDING)
+    return m_labelcontent[lb];
+
+  m_labelcontent[lb] = CONTENT_BUILDING;
+  auto& plabel = state.m_labels[lb];
+  // an empty label only marks a position and a table APPLY_OFFSET_57 patches
+  // is patched in place per reference, neither is merged
+  std::string key = "#" + std::to_string(lb);
+  if (plabel.get_size() && !m_labelpatched[lb])
+  {
+    key.clear();
+    for (auto i = 1; i <= plabel.get_count(); ++i)
+    {
+      auto& token = state.m_data[plabel.get_index() + i];
+      const auto& args = token->get_operation()->get_args();
+      const auto& operands = token->get_operation()->get_operands();
+      key += token->get_operation()->get_name();
+      for (size_t argi = 0; argi < args.size(); ++argi)
+      {
+        key += '\x1f';
+        if (!operands[argi].is_ref() || operands[argi].is_pad())
+        {
+          key += args[argi];
+          continue;
+        }
+        auto ref = operands[argi].get_label();
+        if (ref == NO_INDEX)
+          throw error(error::error_code::internal_error, "Label not found " + token->get_file() + ":"
+                      + std::string(args[argi].substr(1)));
+        // a label referring back to one being keyed only matches its own references
+        if (m_labelcontent[ref] == CONTENT_BUILDING)
+          key += "#" + std::to_string(ref);
+        else
+          key += "@" + std::to_string(labelcontent(state, ref));
+      }
+      key += '\x1e';
+    }
+  }
+
+  auto [it, added] = m_contentids.emplace(std::move(key), static_cast<uint32_t>(m_contentsize.size()));
+  if (added)
+    m_contentsize.push_back(plabel.get_size());
+  m_labelcontent[lb] = it->second;
+  return it->second;
+}
+
+std::vector<jobidx_type>
 pager::
-extractjobs(assembler_state& state, std::shared_ptr<job> pjob)
+extractjobs(assembler_state& state, jobidx_type jobidx)
 {
   // Extract all jobs depending on jobid
-  std::vector<jobid_type> jobids;
-  jobids.push_back(pjob->get_jobid());
-  std::vector<barrierid_type> barriers = pjob->m_barrierids;
-  auto eopnum = pjob->get_eopnum();
-  uint32_t i = 0;
-  while( i < barriers.size())
+  auto& pjob = state.m_jobs[jobidx];
+  ordered_set<jobidx_type> jobids;
+  jobids.insert(jobidx);
+  ordered_set<barrieridx_type> barriers;
+  barriers.insert_all(pjob.m_barrierids);
+  auto eopnum = pjob.get_eopnum();
+  // barriers of the jobs found are appended, each barrier is walked once
+  for (size_t i = 0; i < barriers.items().size(); ++i)
   {
-    auto lbid = barriers[i];
-    auto jj = state.m_localbarriermap[lbid];
-    for (auto j : jj)
+    auto lbid = barriers.items()[i];
+    for (auto j : state.m_localbarriers[lbid])
     {
-      if (eopnum != state.m_jobmap[j]->get_eopnum())
-        throw error(error::error_code::internal_error, "Job " + j
-                    + " having dependency with Job " + jobids[0] +
+      if (eopnum != state.m_jobs[j].get_eopnum())
+        throw error(error::error_code::internal_error, "Job " + state.m_jobs[j].get_jobid()
+                    + " having dependency with Job " + pjob.get_jobid() +
                     " are not expected to be on same page because of .eop");
-      barriers = union_of_lists_inorder<barrierid_type>(barriers, state.m_jobmap[j]->m_barrierids);
+      barriers.insert_all(state.m_jobs[j].m_barrierids);
+      jobids.insert(j);
     }
-    jobids = union_of_lists_inorder<jobid_type>(jobids, state.m_localbarriermap[lbid]);
-    ++i;
   }
   // Explicit dependencies (e.g. launch_job relation)
-  jobids = union_of_lists_inorder<jobid_type>(jobids, pjob->m_dependentjobs);
-  return jobids;
+  jobids.insert_all(pjob.m_dependentjobs);
+  return jobids.release();
 }
 
-std::vector<std::string>
+const std::vector<labelidx_type>&
 pager::
-extractlabels(assembler_state& state, std::shared_ptr<asm_data> token)
+labelclosure(assembler_state& state, labelidx_type lb)
+{
+  // label 'lb' and all labels its content refers to, computed once per label.
+  // Labels referring to each other in a cycle share one closure, it is only
+  // complete once the first label of the cycle is done (Tarjan's SCC).
+  static const std::vector<labelidx_type> none;
+  if (m_labelclosure_state[lb] == closure_state::done)
+    return m_labelclosure[lb];
+  // a label referred to from its own closure is already part of it
+  if (m_labelclosure_state[lb] == closure_state::building)
+  {
+    m_closurelow = std::min(m_closurelow, m_labelclosure_depth[lb]);
+    return none;
+  }
+
+  m_labelclosure_state[lb] = closure_state::building;
+  auto depth = static_cast<uint32_t>(m_closurestack.size());
+  m_labelclosure_depth[lb] = depth;
+  m_closurestack.push_back(lb);
+  auto outerlow = m_closurelow;
+  m_closurelow = depth;
+
+  ordered_set<labelidx_type> labels;
+  labels.insert(lb);
+  auto index = state.m_labels[lb].get_index();
+  for (auto i = 0; i <= state.m_labels[lb].get_count(); ++i)
+    labels.insert_all(extractlabels(state, state.m_data[index+i]));
+  m_labelclosure[lb] = labels.release();
+
+  auto low = m_closurelow;
+  m_closurelow = std::min(outerlow, low);
+  // part of a cycle through a label still being built, the closure so far
+  // goes into that label's closure and is completed with it
+  if (low < depth)
+    return m_labelclosure[lb];
+
+  // every label of the cycle gets the closure of its first label
+  m_labelclosure_state[lb] = closure_state::done;
+  for (auto i = depth + 1; i < m_closurestack.size(); ++i)
+  {
+    auto member = m_closurestack[i];
+    ordered_set<labelidx_type> closure;
+    closure.insert(member);
+    closure.insert_all(m_labelclosure[lb]);
+    m_labelclosure[member] = closure.release();
+    m_labelclosure_state[member] = closure_state::done;
+  }
+  m_closurestack.resize(depth);
+  return m_labelclosure[lb];
+}
+
+std::vector<labelidx_type>
+pager::
+extractlabels(assembler_state& state, const asm_data* token)
 {
   // Extract all labels connected to token
-  std::vector<std::string> labels;
   if (token->isLabel())
-    return labels;
+    return {};
 
-  for (auto &arg : token->get_operation()->get_args())
+  ordered_set<labelidx_type> labels;
+  const auto& args = token->get_operation()->get_args();
+  const auto& operands = token->get_operation()->get_operands();
+  bool ooo = std::find(OOO.begin(), OOO.end(), token->get_operation()->get_name()) != OOO.end();
+  for (size_t argi = 0; argi < args.size(); ++argi)
   {
-    auto it = std::find(OOO.begin(), OOO.end(), token->get_operation()->get_name());
-    if (arg.rfind("@") == 0 && it == OOO.end())
+    if (operands[argi].is_ref() && !operands[argi].is_pad() && !ooo)
     {
-      auto lb = arg.substr(1);
-      if (state.containscratchpads(lb))
-        continue;
-      lb = token->get_file() + ":" + lb;
-      if (state.m_labelmap.find(lb) == state.m_labelmap.end())
-      {
-        throw error(error::error_code::internal_error, "Label not found " + lb);
-      }
-      std::vector<std::string> vlb {lb};
-      labels = union_of_lists_inorder<std::string>(labels, vlb);
-      auto index = state.m_labelmap[lb]->get_index();
-      for (auto i = 0; i <= state.m_labelmap[lb]->get_count(); ++i)
-      {
-        auto elb = extractlabels(state, state.m_data[index+i]);
-        labels = union_of_lists_inorder<std::string>(labels, elb);
-      }
+      auto lbidx = operands[argi].get_label();
+      if (lbidx == NO_INDEX)
+        throw error(error::error_code::internal_error, "Label not found " + token->get_file() + ":"
+                    + std::string(args[argi].substr(1)));
+      labels.insert_all(labelclosure(state, lbidx));
     }
   }
-  return labels;
+  return labels.release();
 }
 
-std::vector<std::string>
+std::vector<refid_type>
 pager::
-extract_externallabels(assembler_state& /*state*/, std::shared_ptr<asm_data> token)
+extract_externallabels(assembler_state& /*state*/, const asm_data* token)
 {
   // extract all external labels connected to token
-  std::vector<std::string> labels;
   if (token->isLabel())
-    return labels;
+    return {};
+
+  auto it = std::find(OOO.begin(), OOO.end(), token->get_operation()->get_name());
+  if (it == OOO.end())
+    return {};
 
-  for (auto &arg : token->get_operation()->get_args())
+  ordered_set<refid_type> labels;
+  const auto& args = token->get_operation()->get_args();
+  const auto& operands = token->get_operation()->get_operands();
+  for (size_t argi = 0; argi < args.size(); ++argi)
   {
-    if (arg.rfind("@") != 0)
+    if (!operands[argi].is_ref())
       continue;
 
-    auto it = std::find(OOO.begin(), OOO.end(), token->get_operation()->get_name());
-    if (it == OOO.end())
-      continue;
+    auto ref = operands[argi].get_ref();
+    if (labels.insert(ref) && !m_externalnames.count(ref))
+      m_externalnames.emplace(ref, token->get_file() + ":" + std::string(args[argi].substr(1)));
+  }
+  return labels.release();
+}
+
+void
+pager::
+joblabels(assembler_state& state, jobidx_type jobidx)
+{
+  // labels and external labels used by the text of a job, computed once per job
+  if (m_joblabels_done[jobidx])
+    return;
 
-    auto lb = arg.substr(1);
-    lb = token->get_file() + ":" + lb;
-    std::vector<std::string> vlb {lb};
-    labels = union_of_lists_inorder<std::string>(labels, vlb);
+  ordered_set<labelidx_type> labels;
+  ordered_set<refid_type> external_labels;
+  auto& pjob = state.m_jobs[jobidx];
+  for (auto j = pjob.get_start_index(); j < pjob.get_end_index() + 1; ++j)
+  {
+    auto& token = state.m_data[j];
+    labels.insert_all(extractlabels(state, token));
+    external_labels.insert_all(extract_externallabels(state, token));
   }
-  return labels;  
+  m_joblabels[jobidx] = labels.release();
+  m_jobexternallabels[jobidx] = external_labels.release();
+  m_joblabels_done[jobidx] = true;
 }
 
 offset_type
 pager::
-extractjobsandlabels(assembler_state& state, std::shared_ptr<job> pjob,
-                     std::vector<jobid_type>& job_list,
-                     std::vector<std::string>& labels_list,
-                     std::vector<std::string>& external_labels_list)
+extractjobsandlabels(assembler_state& state, jobidx_type jobidx,
+                     std::vector<jobidx_type>& job_list,
+                     std::vector<labelidx_type>& labels_list,
+                     std::vector<refid_type>& external_labels_list)
 {
   /*
    * extract all releated(jobs which share local barrier with current jobid) jobs
    * and labels with jobid also return size of complete text section in that page
    */
 
-  job_list = extractjobs(state, pjob);
+  job_list = extractjobs(state, jobidx);
+  return jobsandlabels(state, job_list, labels_list, external_labels_list);
+}
+
+offset_type
+pager::
+jobsandlabels(assembler_state& state, const std::vector<jobidx_type>& job_list,
+              std::vector<labelidx_type>& labels_list,
+              std::vector<refid_type>& external_labels_list)
+{
+  // labels of the jobs in job_list and the size of their text section
   offset_type tsize = 0;
+  ordered_set<labelidx_type> labels;
+  ordered_set<refid_type> external_labels;
   for (auto djid : job_list)
   {
-    tsize +=  state.m_jobmap[djid]->get_end() - state.m_jobmap[djid]->get_start();
-    for (auto j = state.m_jobmap[djid]->get_start_index(); j < state.m_jobmap[djid]->get_end_index() + 1; ++j)
+    auto& djob = state.m_jobs[djid];
+    tsize +=  djob.get_end() - djob.get_start();
+    joblabels(state, djid);
+    labels.insert_all(m_joblabels[djid]);
+    external_labels.insert_all(m_jobexternallabels[djid]);
+  }
+  labels_list = labels.release();
+  external_labels_list = external_labels.release();
+  return tsize;
+}
+
+std::vector<jobidx_type>
+pager::
+extractlaunchchain(assembler_state& state, jobidx_type jobidx, const std::vector<bool>& grouped)
+{
+  // launched jobs are followed transitively with their own dependencies, jobs
+  // an earlier group took are only repeated when launched directly
+  ordered_set<jobidx_type> jobids;
+  jobids.insert_all(extractjobs(state, jobidx));
+  ordered_set<jobidx_type> expanded;
+  expanded.insert(jobidx);
+  for (size_t i = 0; i < jobids.items().size(); ++i)
+  {
+    for (auto djid : state.m_jobs[jobids.items()[i]].m_dependentjobs)
     {
-      auto token = state.m_data[j];
-      auto elb = extractlabels(state, token);
-      labels_list = union_of_lists_inorder<std::string>(labels_list, elb);
-      auto eelb = extract_externallabels(state, token);
-      external_labels_list = union_of_lists_inorder<std::string>(external_labels_list, eelb);
+      if (grouped[djid] || !expanded.insert(djid))
+        continue;
+      jobids.insert_all(extractjobs(state, djid));
     }
   }
-  return tsize;
+  return jobids.release();
 }
 
-std::vector<std::string>
+std::vector<labelidx_type>
 pager::
-labelalignmentsorter(assembler_state& state, std::vector<std::string>& clist)
+labelalignmentsorter(assembler_state& state, std::vector<labelidx_type>& clist)
 {
   // sort labels in order of there align
-  std::vector<std::string> labels;
+  std::vector<labelidx_type> labels;
   for (auto lb : clist)
   {
-    auto index = state.m_labelmap[lb]->get_index();
+    auto index = state.m_labels[lb].get_index();
     auto token = state.m_data[index+1];
     if (ALIGNMENT_16 == ALIGNMAP.at(token->get_operation()->get_name()))
       labels.emplace_back(lb);
@@ -204,7 +341,7 @@ labelalignmentsorter(assembler_state& state, std::vector<std::string>& clist)
 
   for (auto lb : clist)
   {
-    auto index = state.m_labelmap[lb]->get_index();
+    auto index = state.m_labels[lb].get_index();
     auto token = state.m_data[index+1];
     if (ALIGNMENT_4 == ALIGNMAP.at(token->get_operation()->get_name()))
       labels.emplace_back(lb);
@@ -221,9 +358,9 @@ labelalignmentsorter(assembler_state& state, std::vector<std::string>& clist)
 void
 pager::
 assignpagenumber(assembler_state& state, uint32_t colnum,
-                 std::vector<jobid_type>& jobs,
-                 std::vector<std::string> &labels,
-                 std::vector<std::string> &externallabels,
+                 std::vector<jobidx_type>& jobs,
+                 std::vector<labelidx_type> &labels,
+                 std::vector<refid_type> &externallabels,
                  uint32_t &pagenum, std::vector<page> &pages,
                  bool islastpage, uint32_t tsize, uint32_t dsize,
                  uint32_t relative_page_index)
@@ -237,131 +374,384 @@ assignpagenumber(assembler_state& state, uint32_t colnum,
   if (jobs.size() == 0)
     return;
 
-  if (jobs.size() == 1 && !jobs[0].compare(EOF_ID))
+  if (jobs.size() == 1 && jobs[0] == state.m_eofjob)
     return;
 
+  if (state.m_eofjob == NO_INDEX)
+    throw error(error::error_code::internal_error, "eof not found in col:" + std::to_string(colnum));
+
   // sort labels according to label alignment
   labels = labelalignmentsorter(state, labels);
-  for (auto &djid : jobs)
+  for (auto djid : jobs)
   {
-    state.m_jobmap[djid]->set_pagenum(pagenum);
-    for (auto j = state.m_jobmap[djid]->get_start_index();
-         j < state.m_jobmap[djid]->get_end_index() + 1; ++j)
+    auto& djob = state.m_jobs[djid];
+    djob.set_pagenum(pagenum);
+    for (auto j = djob.get_start_index(); j < djob.get_end_index() + 1; ++j)
     {
       state.m_data[j]->set_pagenum(pagenum);
       lpage.m_text.emplace_back(state.m_data[j]);
     }
   }
-  for (auto &lb : labels)
+  // with dedup_data only the first label of a content keeps its body, the
+  // others are placed right after its label token and so share its position
+  std::vector<labelidx_type> bodies;
+  std::vector<std::vector<labelidx_type>> aliases;
+  std::unordered_map<uint32_t, size_t> contentbody;
+  std::unordered_set<labelidx_type> placed;
+  for (auto lb : labels)
   {
-    state.m_labelmap[lb]->set_pagenum(pagenum);
-    auto index = state.m_labelmap[lb]->get_index();
-    for (auto i = 0; i <= state.m_labelmap[lb]->get_count(); ++i)
+    if (!m_dedup_data)
+    {
+      bodies.push_back(lb);
+      aliases.emplace_back();
+      continue;
+    }
+    if (!placed.insert(lb).second)
+      continue;
+    auto [it, added] = contentbody.emplace(labelcontent(state, lb), bodies.size());
+    if (added)
+    {
+      bodies.push_back(lb);
+      aliases.emplace_back();
+    }
+    else
+      aliases[it->second].push_back(lb);
+  }
+  for (size_t b = 0; b < bodies.size(); ++b)
+  {
+    auto& plabel = state.m_labels[bodies[b]];
+    plabel.set_pagenum(pagenum);
+    auto index = plabel.get_index();
+    state.m_data[index]->set_pagenum(pagenum);
+    lpage.m_data.emplace_back(state.m_data[index]);
+    for (auto alias : aliases[b])
+    {
+      auto& palias = state.m_labels[alias];
+      palias.set_pagenum(pagenum);
+      for (auto i = 0; i <= palias.get_count(); ++i)
+        state.m_data[palias.get_index()+i]->set_pagenum(pagenum);
+      lpage.m_data.emplace_back(state.m_data[palias.get_index()]);
+    }
+    for (auto i = 1; i <= plabel.get_count(); ++i)
     {
       state.m_data[index+i]->set_pagenum(pagenum);
       lpage.m_data.emplace_back(state.m_data[index+i]);
     }
   }
   // add eof at end of page
-  lpage.m_text.emplace_back(state.m_data[state.m_jobmap[EOF_ID]->get_start_index()]);
+  lpage.m_text.emplace_back(state.m_data[state.m_jobs[state.m_eofjob].get_start_index()]);
   auto aligner = dsize ? datasectionaligner(tsize) : 0;
   // add align for data section
   if (aligner)
-    lpage.m_text.emplace_back(std::make_shared<asm_data>(std::make_shared<operation>(".align", "16"),
-                                                    operation_type::op, code_section::text, 0,
-                                                    (uint32_t)-1, 0, ".align 16", "default"));
+  {
+    // shared and never modified, so concurrent pagers never touch an arena
+    static const std::string align_name(".align");
+    static const std::string default_file("default");
+    static operation align_op(&align_name, {"16"});
+    static asm_data align_token(&align_op, operation_type::op, code_section::text, 0,
+                                (uint32_t)-1, 0, 0, &default_file);
+    lpage.m_text.emplace_back(&align_token);
+  }
   uint32_t cur_page_len = PAGE_HEADER_SIZE + tsize + EOF_SIZE + aligner + dsize;
   cur_page_len = (((cur_page_len + 3) >> 2) << 2); // round off to next multiple of 4
   lpage.set_cur_page_len(cur_page_len);
   lpage.set_in_order_page_len(0);
-  lpage.set_externallabels(externallabels);
+  std::vector<std::string> externalnames;
+  for (auto ref : externallabels)
+    externalnames.push_back(m_externalnames.at(ref));
+  lpage.set_externallabels(externalnames);
   pages.emplace_back(std::move(lpage));
   if (pages.size() > 1 && pages.size()-2 >= relative_page_index)
     pages[pages.size() - 2].set_in_order_page_len(cur_page_len);
   ++pagenum;
 }
 
-uint32_t
+bool
 pager::
-pagify(assembler_state& state, uint32_t col, std::vector<page>& pages, uint32_t relative_page_index)
+fits(offset_type tsize, offset_type dsize)
 {
-  // pagify the content
-  offset_type page_tsize = 0;
-  offset_type page_dsize = 0;
-  uint32_t page_index = relative_page_index;
-  std::vector<jobid_type> page_jobs;
-  std::vector<std::string> page_labels;
-  std::vector<std::string> page_external_labels;
-  auto joblist = state.get_job_list();
+  // NOTE: data section is always 16 Byte aligned
+  return (PAGE_HEADER_SIZE + tsize + EOF_SIZE + datasectionaligner(tsize) + dsize) <= m_page_size;
+}
+
+offset_type
+pager::
+oootablesize(size_t targets)
+{
+  return (targets > OOO_HEADER_SLOTS) ? targets * OOO_TABLE_ENTRY_SIZE : 0;
+}
+
+offset_type
+pager::
+newdatasize(const page_groups& pg, const job_group& group)
+{
+  auto dsize = group.dsize;
+  for (auto content : group.contents)
+    if (pg.contents.count(content))
+      dsize -= m_contentsize[content];
+  return dsize;
+}
+
+bool
+pager::
+fits(const page_groups& pg, const job_group& group)
+{
+  // the out of order table is part of the data section
+  auto targets = pg.ooo_targets.size();
+  for (auto& label : group.external_labels)
+    targets += pg.ooo_targets.count(label) ? 0 : 1;
+  return fits(pg.tsize + group.tsize, pg.dsize + newdatasize(pg, group) + oootablesize(targets));
+}
 
-  for( auto jobid : state.m_jobids)
+void
+pager::
+addgroup(page_groups& pg, uint32_t gidx, const job_group& group)
+{
+  pg.groups.push_back(gidx);
+  pg.tsize += group.tsize;
+  pg.dsize += newdatasize(pg, group);
+  pg.ooo_targets.insert(group.external_labels.begin(), group.external_labels.end());
+  pg.contents.insert(group.contents.begin(), group.contents.end());
+}
+
+size_t
+pager::
+extractgroups(assembler_state& state, size_t pos, std::vector<job_group>& groups, std::vector<bool>& grouped)
+{
+  // .eop concludes the region
+  auto end = pos;
+  while (end < state.m_jobids.size() && !state.m_jobs[state.m_jobids[end]].is_eop())
+    ++end;
+
+  // along the execution path jobs run when they are launched, the region is
+  // walked from the jobs nobody launches
+  std::vector<jobidx_type> region(state.m_jobids.begin() + pos, state.m_jobids.begin() + end);
+  if (m_mode == pagination_mode::exec)
+    std::stable_partition(region.begin(), region.end(), [&state](jobidx_type jobid) {
+      return state.m_joblaunches[jobid].empty();
+    });
+
+  for (auto jobid : region)
   {
-    auto pjob = state.m_jobmap[jobid];
-    std::vector<jobid_type> job_list;
-    std::vector<std::string> labels_list;
-    std::vector<std::string> external_labels_list;
-    auto it = std::find(page_jobs.begin(), page_jobs.end(), jobid);
-    // job already added if job have page assigned or job taken in current page or jodid is 'eof'
-    if (pjob->get_pagenum() != NO_PAGE || it != page_jobs.end() || !jobid.compare(EOF_ID))
+    // job already added if it is in an earlier group or jodid is 'eof'
+    if (grouped[jobid] || jobid == state.m_eofjob)
       continue;
 
-    if (is_eop(jobid))
+    // get total text section size, jobs and labels releated to jobid(current job)
+    // NOTE: jobs depending on jobid are returned even if an earlier group has them
+    // (note that multiple jobs might depend on the same job)
+    job_group group;
+    if (m_mode == pagination_mode::exec)
     {
-      if (!page_jobs.size())
+      group.jobs = extractlaunchchain(state, jobid, grouped);
+      group.tsize = jobsandlabels(state, group.jobs, group.labels, group.external_labels);
+      group.dsize = getdatasectionsize(state, group.labels, group.contents);
+      // a chain too big for a page is split at the launches
+      if (fits(page_groups{}, group))
+      {
+        for (auto djid : group.jobs)
+          grouped[djid] = true;
+        groups.emplace_back(std::move(group));
         continue;
-      // conclude the page
-      assignpagenumber(state, col, page_jobs, page_labels, page_external_labels, page_index, pages, false, page_tsize, page_dsize, relative_page_index);
-      page_tsize = page_dsize = 0;
-      page_jobs.clear();
-      page_labels.clear();
-      page_external_labels.clear();
-      continue;
+      }
     }
-
-    // get total text section size, jobs and labels releated to jobid(current job) which are not already taken in current page
-    // don't return jobs/labels for a job which is already in this page a second time (note that multiple jobs might depend on
-    // the same job)
-    auto tsize = extractjobsandlabels(state, pjob, job_list, labels_list, external_labels_list);
-
-    // calculate alignment bytes needed bet text and data section
-    // NOTE: data section is always 16 Byte aligned
-    auto dsectionaligner = datasectionaligner(page_tsize + tsize);
+    group.tsize = extractjobsandlabels(state, jobid, group.jobs, group.labels, group.external_labels);
 
     // get data section size for jobs(related to current job)
-    auto dsize = getdatasectionsize(state, labels_list);
-
-    auto jobdsectionaligner = datasectionaligner(tsize);
+    group.dsize = getdatasectionsize(state, group.labels, group.contents);
 
     //check if job can fit in one page
-    if ((tsize + jobdsectionaligner + dsize + EOF_SIZE + PAGE_HEADER_SIZE) > m_page_size)
+    if (!fits(page_groups{}, group))
       throw error(error::error_code::internal_error, "text and data section size " +
-                  std::to_string(tsize + jobdsectionaligner + dsize + EOF_SIZE + PAGE_HEADER_SIZE)
+                  std::to_string(group.tsize + datasectionaligner(group.tsize) + group.dsize +
+                                 oootablesize(group.external_labels.size()) + EOF_SIZE + PAGE_HEADER_SIZE)
                   + " > pagesize(" + std::to_string(m_page_size) + ")");
 
-    // check if current job fit in current page along with other jobs already in page
-    if ((page_tsize + page_dsize + tsize + dsectionaligner + dsize + EOF_SIZE + PAGE_HEADER_SIZE) > m_page_size)
+    for (auto djid : group.jobs)
+      grouped[djid] = true;
+    groups.emplace_back(std::move(group));
+  }
+  return (end < state.m_jobids.size()) ? end + 1 : end;
+}
+
+std::vector<pager::page_groups>
+pager::
+packgreedy(const std::vector<job_group>& groups)
+{
+  // in source order, conclude the page once the next group doesn't fit
+  std::vector<page_groups> pages;
+  for (uint32_t g = 0; g < groups.size(); ++g)
+  {
+    if (pages.empty() || !fits(pages.back(), groups[g]))
+      pages.emplace_back();
+    addgroup(pages.back(), g, groups[g]);
+  }
+  return pages;
+}
+
+std::vector<pager::page_groups>
+pager::
+packffd(const std::vector<job_group>& groups)
+{
+  // first fit decreasing: largest groups first, each into the first page with
+  // room. Ties keep source order so the result is deterministic.
+  std::vector<uint32_t> order(groups.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&groups](uint32_t a, uint32_t b) {
+    return groups[a].tsize + groups[a].dsize > groups[b].tsize + groups[b].dsize;
+  });
+
+  std::vector<page_groups> pages;
+  for (auto g : order)
+  {
+    auto it = std::find_if(pages.begin(), pages.end(), [this, &groups, g](const page_groups& pg) {
+      return fits(pg, groups[g]);
+    });
+    if (it == pages.end())
+      it = pages.emplace(pages.end());
+    addgroup(*it, g, groups[g]);
+  }
+
+  // groups within a page and the pages themselves stay in source order
+  for (auto& pg : pages)
+    std::sort(pg.groups.begin(), pg.groups.end());
+  std::sort(pages.begin(), pages.end(), [](const page_groups& a, const page_groups& b) {
+    return a.groups.front() < b.groups.front();
+  });
+  return pages;
+}
+
+uint32_t
+pager::
+estimatetransitions(assembler_state& state)
+{
+  uint32_t transitions = 0;
+  uint32_t curpage = NO_PAGE;
+  std::vector<bool> visited(state.m_jobs.size());
+  std::vector<jobidx_type> path;
+  auto walk = [&](jobidx_type root) {
+    path.push_back(root);
+    while (!path.empty())
+    {
+      auto jobid = path.back();
+      path.pop_back();
+      if (visited[jobid])
+        continue;
+      visited[jobid] = true;
+
+      auto& jobpages = m_jobpages[jobid];
+      if (!jobpages.empty() && std::find(jobpages.begin(), jobpages.end(), curpage) == jobpages.end())
+      {
+        if (curpage != NO_PAGE)
+          ++transitions;
+        curpage = jobpages.front();
+      }
+      auto& pjob = state.m_jobs[jobid];
+      for (auto j = pjob.get_start_index(); j < pjob.get_end_index() + 1; ++j)
+      {
+        auto& token = state.m_data[j];
+        if (!token->isLabel() && std::find(OOO.begin(), OOO.end(), token->get_operation()->get_name()) != OOO.end())
+          transitions += 2;
+      }
+      // launched jobs run next, in launch order
+      path.insert(path.end(), pjob.m_dependentjobs.rbegin(), pjob.m_dependentjobs.rend());
+    }
+  };
+
+  auto onpath = [&state](jobidx_type jobid) {
+    return jobid != state.m_eofjob && !state.m_jobs[jobid].is_eop();
+  };
+  for (auto jobid : state.m_jobids)
+    if (onpath(jobid) && state.m_joblaunches[jobid].empty())
+      walk(jobid);
+  // jobs only launched from a launch cycle
+  for (auto jobid : state.m_jobids)
+    if (onpath(jobid))
+      walk(jobid);
+  return transitions;
+}
+
+uint32_t
+pager::
+pagify(assembler_state& state, uint32_t col, std::vector<page>& pages, uint32_t relative_page_index)
+{
+  // pagify the content, one .eop region at a time
+  uint32_t page_index = relative_page_index;
+  // jobs taken in a group
+  std::vector<bool> grouped(state.m_jobs.size());
+
+  m_labelclosure.assign(state.m_labels.size(), {});
+  m_labelclosure_state.assign(state.m_labels.size(), closure_state::none);
+  m_labelclosure_depth.assign(state.m_labels.size(), 0);
+  m_closurestack.clear();
+  m_joblabels.assign(state.m_jobs.size(), {});
+  m_jobexternallabels.assign(state.m_jobs.size(), {});
+  m_joblabels_done.assign(state.m_jobs.size(), false);
+  m_jobpages.assign(state.m_jobs.size(), {});
+  m_labelcontent.assign(m_dedup_data ? state.m_labels.size() : 0, NO_INDEX);
+  m_contentids.clear();
+  m_contentsize.clear();
+  m_labelpatched.assign(m_dedup_data ? state.m_labels.size() : 0, false);
+  m_externalnames.clear();
+  if (m_dedup_data)
+    for (const auto& token : state.m_data)
     {
-      // if current job dont fit in current page, conclude the page
-      assignpagenumber(state, col, page_jobs, page_labels, page_external_labels, page_index, pages, false, page_tsize, page_dsize, relative_page_index);
-      page_tsize = page_dsize = 0;
-      page_jobs.clear();
-      page_labels.clear();
-      page_external_labels.clear();
+      if (token->isLabel() || token->get_operation()->get_name().compare("apply_offset_57"))
+        continue;
+      const auto& operands = token->get_operation()->get_operands();
+      if (operands.empty() || !operands[0].is_ref())
+        continue;
+      auto lbidx = operands[0].get_label();
+      if (lbidx != NO_INDEX)
+        m_labelpatched[lbidx] = true;
     }
 
-    page_tsize += tsize;
-    page_dsize += dsize;
-    page_jobs.insert( page_jobs.end(), job_list.begin(), job_list.end() );
-    page_labels.insert( page_labels.end(), labels_list.begin(), labels_list.end() );
-    page_external_labels.insert( page_external_labels.end(), external_labels_list.begin(), external_labels_list.end() );
+  size_t pos = 0;
+  while (pos < state.m_jobids.size())
+  {
+    std::vector<job_group> groups;
+    pos = extractgroups(state, pos, groups, grouped);
+    auto eop = state.m_jobs[state.m_jobids[pos - 1]].is_eop();
+
+    auto packed = (m_mode == pagination_mode::ffd) ? packffd(groups) : packgreedy(groups);
+    for (auto& pg : packed)
+    {
+      std::vector<jobidx_type> page_jobs;
+      std::vector<labelidx_type> page_labels;
+      std::vector<refid_type> page_external_labels;
+      for (auto g : pg.groups)
+      {
+        page_jobs.insert(page_jobs.end(), groups[g].jobs.begin(), groups[g].jobs.end());
+        page_labels.insert(page_labels.end(), groups[g].labels.begin(), groups[g].labels.end());
+        page_external_labels.insert(page_external_labels.end(), groups[g].external_labels.begin(),
+                                    groups[g].external_labels.end());
+      }
+      for (auto djid : page_jobs)
+        m_jobpages[djid].push_back(page_index);
+      assignpagenumber(state, col, page_jobs, page_labels, page_external_labels, page_index, pages, false,
+                       pg.tsize, pg.dsize + oootablesize(pg.ooo_targets.size()), relative_page_index);
+
+      auto& lpage = pages.back();
+      page_report::page_info info;
+      info.index = lpage.get_pagenum();
+      info.text_bytes = PAGE_HEADER_SIZE + pg.tsize + EOF_SIZE;
+      info.data_bytes = pg.dsize;
+      info.ooo_table_bytes = oootablesize(pg.ooo_targets.size());
+      info.align_padding = lpage.get_cur_page_len() - info.text_bytes - info.data_bytes - info.ooo_table_bytes;
+      info.tail_padding = m_page_size - lpage.get_cur_page_len();
+      info.jobs = page_jobs.size();
+      info.labels = page_labels.size();
+      if (&pg != &packed.back())
+        info.reason = page_report::close_reason::size_limit;
+      else
+        info.reason = eop ? page_report::close_reason::eop : page_report::close_reason::end;
+      lpage.set_info(info);
+    }
   }
 
-  if (page_jobs.size())
-  {
-    assignpagenumber(state, col, page_jobs, page_labels, page_external_labels, page_index, pages, true, page_tsize, page_dsize, relative_page_index);
-    page_index += 1;
-  } else if (page_index-relative_page_index > 0)
-    pages[page_index-relative_page_index-1].set_islastpage(true);
+  if (pages.size() > relative_page_index)
+    pages.back().set_islastpage(true);
+  m_transitions = estimatetransitions(state);
   return page_index;
 }
 
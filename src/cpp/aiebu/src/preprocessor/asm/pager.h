@@ -5,7 +5,10 @@
 #define _AIEBU_PREPROCESSOR_ASM_PAGER_H_
 
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include "asm/asm_parser.h"
+#include "assembler_options.h"
 #include "assembler_state.h"
 #include "asm/page.h"
 
@@ -14,6 +17,8 @@ namespace aiebu {
 class pager
 {
   uint32_t m_page_size;
+  pagination_mode m_mode;
+  bool m_dedup_data;
   constexpr static offset_type PAGE_HEADER_SIZE = 16;
   constexpr static offset_type EOF_SIZE = 4;
   constexpr static offset_type DATA_SECTION_ALIGNMENT = 16;
@@ -23,49 +28,179 @@ class pager
   std::map<std::string , offset_type> ALIGNMAP = {{"uc_dma_bd", ALIGNMENT_16}, {".long", ALIGNMENT_4}};
   std::vector<std::string> OOO = {"load_pdi", "preemption_checkpoint"};
 
+  // insertion ordered set, dependencies are kept in the order they are found
   template <typename T>
-  std::vector<T> union_of_lists_inorder(std::vector<T> &vec1, std::vector<T>& vec2);
+  class ordered_set
+  {
+    std::unordered_set<T> m_seen;
+    std::vector<T> m_items;
+
+  public:
+    bool insert(const T& item)
+    {
+      if (!m_seen.insert(item).second)
+        return false;
+      m_items.push_back(item);
+      return true;
+    }
+
+    template <typename C>
+    void insert_all(const C& items)
+    {
+      for (const auto& item : items)
+        insert(item);
+    }
+
+    const std::vector<T>& items() const { return m_items; }
+
+    std::vector<T> release()
+    {
+      m_seen.clear();
+      return std::move(m_items);
+    }
+  };
+
+  // closures memoized for one pagify(), indexed by label and job id
+  enum class closure_state : uint8_t { none, building, done };
+  std::vector<std::vector<labelidx_type>> m_labelclosure;
+  std::vector<closure_state> m_labelclosure_state;
+  // labels still being built and their position in it, with the lowest
+  // position a closure in progress refers back to
+  std::vector<uint32_t> m_labelclosure_depth;
+  std::vector<labelidx_type> m_closurestack;
+  uint32_t m_closurelow = 0;
+  std::vector<std::vector<labelidx_type>> m_joblabels;
+  std::vector<std::vector<refid_type>> m_jobexternallabels;
+  // "<file>:<label>" of the out of order targets found, for the pages
+  std::unordered_map<refid_type, std::string> m_externalnames;
+  std::vector<bool> m_joblabels_done;
+
+  const std::vector<labelidx_type>& labelclosure(assembler_state& state, labelidx_type lb);
+
+  void joblabels(assembler_state& state, jobidx_type jobidx);
 
   offset_type datasectionaligner(offset_type size);
 
+  // with dedup_data a content is counted once, 'contents' gets the distinct
+  // contents of labels_list
   offset_type getdatasectionsize(assembler_state& state,
-                                 std::vector<std::string>& labels_list);
+                                 std::vector<labelidx_type>& labels_list,
+                                 std::vector<uint32_t>& contents);
+
+  // Data label contents memoized for one pagify(), only with dedup_data.
+  // Labels whose bodies have the same ops and args get the same id, a
+  // reference to a label counts as its content as identical labels of a
+  // page share their position.
+  constexpr static uint32_t CONTENT_BUILDING = NO_INDEX - 1;
+  std::vector<uint32_t> m_labelcontent;
+  std::unordered_map<std::string, uint32_t> m_contentids;
+  std::vector<offset_type> m_contentsize;
+  // tables of APPLY_OFFSET_57, patched where they are placed
+  std::vector<bool> m_labelpatched;
 
-  std::vector<jobid_type> extractjobs(assembler_state& state,
-                                      std::shared_ptr<job> pjob);
+  uint32_t labelcontent(assembler_state& state, labelidx_type lb);
 
-  std::vector<std::string> extractlabels(assembler_state& state,
-                                         std::shared_ptr<asm_data> token);
+  std::vector<jobidx_type> extractjobs(assembler_state& state,
+                                       jobidx_type jobidx);
 
-  std::vector<std::string>
-  extract_externallabels(assembler_state& state, std::shared_ptr<asm_data> token);
+  std::vector<labelidx_type> extractlabels(assembler_state& state,
+                                           const asm_data* token);
+
+  std::vector<refid_type>
+  extract_externallabels(assembler_state& state, const asm_data* token);
 
   offset_type extractjobsandlabels(assembler_state& state,
-                                   std::shared_ptr<job> pjob,
-                                   std::vector<jobid_type>& job_list,
-                                   std::vector<std::string>& labels_list,
-                                   std::vector<std::string>& external_labels_list);
+                                   jobidx_type jobidx,
+                                   std::vector<jobidx_type>& job_list,
+                                   std::vector<labelidx_type>& labels_list,
+                                   std::vector<refid_type>& external_labels_list);
+
+  offset_type jobsandlabels(assembler_state& state,
+                            const std::vector<jobidx_type>& job_list,
+                            std::vector<labelidx_type>& labels_list,
+                            std::vector<refid_type>& external_labels_list);
+
+  // jobidx with its dependencies and the whole chain of jobs it launches
+  std::vector<jobidx_type> extractlaunchchain(assembler_state& state,
+                                              jobidx_type jobidx,
+                                              const std::vector<bool>& grouped);
+
+  std::vector<labelidx_type> labelalignmentsorter(assembler_state& state,
+                                                  std::vector<labelidx_type>& clist);
+
+  // a job with everything it depends on, pages are packed with whole groups
+  struct job_group
+  {
+    std::vector<jobidx_type> jobs;
+    std::vector<labelidx_type> labels;
+    std::vector<refid_type> external_labels;
+    // distinct data label contents, only with dedup_data
+    std::vector<uint32_t> contents;
+    offset_type tsize;
+    offset_type dsize;
+  };
+
+  // groups of one page, in source order
+  struct page_groups
+  {
+    std::vector<uint32_t> groups;
+    offset_type tsize = 0;
+    offset_type dsize = 0;
+    // distinct out of order targets
+    std::unordered_set<refid_type> ooo_targets;
+    // distinct data label contents
+    std::unordered_set<uint32_t> contents;
+  };
+
+  bool fits(offset_type tsize, offset_type dsize);
+
+  // bytes of the out of order table of a page with 'targets' targets
+  offset_type oootablesize(size_t targets);
+
+  // data bytes 'group' adds to 'pg', contents the page has are not repeated
+  offset_type newdatasize(const page_groups& pg, const job_group& group);
 
-  std::vector<std::string> labelalignmentsorter(assembler_state& state,
-                                                std::vector<std::string>& clist);
+  bool fits(const page_groups& pg, const job_group& group);
+
+  void addgroup(page_groups& pg, uint32_t gidx, const job_group& group);
+
+  // groups of the .eop region starting at m_jobids[pos], returns the position
+  // after the region
+  size_t extractgroups(assembler_state& state, size_t pos, std::vector<job_group>& groups,
+                       std::vector<bool>& grouped);
+
+  std::vector<page_groups> packgreedy(const std::vector<job_group>& groups);
+
+  std::vector<page_groups> packffd(const std::vector<job_group>& groups);
+
+  // pages each job was placed on, a job launched by jobs of several groups
+  // is placed with each of them
+  std::vector<std::vector<uint32_t>> m_jobpages;
+  uint32_t m_transitions = 0;
+
+  uint32_t estimatetransitions(assembler_state& state);
 
   void assignpagenumber(assembler_state& state, uint32_t colnum,
-                        std::vector<jobid_type>& jobs,
-                        std::vector<std::string> &labels,
-                        std::vector<std::string> &externallabels,
+                        std::vector<jobidx_type>& jobs,
+                        std::vector<labelidx_type> &labels,
+                        std::vector<refid_type> &externallabels,
                         uint32_t &pagenum,
                         std::vector<page> &pages,
                         bool islastpage, uint32_t tsize, uint32_t dsize,
                         uint32_t relative_page_index);
-  bool is_eop(const std::string jobid)
-  {
-    return !jobid.substr(0,3).compare(EOP_ID);
-  }
 
 public:
-  pager(uint32_t page_size): m_page_size(page_size) {}  
+  pager(uint32_t page_size, pagination_mode mode = pagination_mode::greedy, bool dedup_data = false)
+    : m_page_size(page_size), m_mode(mode), m_dedup_data(dedup_data) {}
   uint32_t pagify(assembler_state& state, uint32_t col, std::vector<page>& pages, uint32_t relative_page_index);
 
+  // Estimated page switches of the last pagify(). The expected execution
+  // path runs the jobs that are not launched by other jobs in source order,
+  // each followed depth first by the jobs it launches. Every step to a job
+  // not on the current page is one switch, every load_pdi and
+  // preemption_checkpoint jumps to its out of order page and back, two.
+  uint32_t get_transitions() const { return m_transitions; }
+
 };
 
 }
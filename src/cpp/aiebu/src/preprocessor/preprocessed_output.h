@@ -4,12 +4,18 @@
 #ifndef _AIEBU_PREPROCESSOR_PREPROCESSED_OUTPUT_H_
 #define _AIEBU_PREPROCESSOR_PREPROCESSED_OUTPUT_H_
 
+#include <vector>
+#include "aiebu_assembler.h"
+
 namespace aiebu {
 
 class preprocessed_output
 {
 public:
   preprocessed_output() {}
+
+  // pagination of the columns, for targets that paginate
+  virtual std::vector<page_report> get_page_report() const { return {}; }
 };
 
 }
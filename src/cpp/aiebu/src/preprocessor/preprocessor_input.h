@@ -7,9 +7,13 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <map>
 #include "symbol.h"
+#include "assembler_options.h"
 #include "aiebu_error.h"
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
 
 namespace aiebu {
 
@@ -18,6 +22,20 @@ class preprocessor_input
 protected:
   std::map<std::string, std::vector<char>> m_data;
   std::vector<symbol> m_sym;
+  assembler_options m_options;
+
+  // addends and buffer sizes are only allowed past 32 bit in elf64 mode
+  uint64_t get_64_bit_property(const boost::property_tree::ptree& pt, const std::string& property, bool defaultvalue = false) const
+  {
+    uint64_t value = defaultvalue ? pt.get<uint64_t>(property, 0) : pt.get<uint64_t>(property);
+    if (!m_options.get_elf64() && value > std::numeric_limits<uint32_t>::max())
+    {
+      auto error_msg = boost::format("Invalid %s (0x%x) > 32bit found") % property % value;
+      throw error(error::error_code::invalid_asm, error_msg.str());
+    }
+    return value;
+  }
+
 public:
   preprocessor_input() {}
   virtual ~preprocessor_input() = default;
@@ -29,6 +47,16 @@ public:
                         const std::vector<std::string>&,
                         const std::map<uint8_t, std::vector<char> >& ctrlpkt) = 0;
 
+  void set_options(const assembler_options& options)
+  {
+    m_options = options;
+  }
+
+  const assembler_options& get_options() const
+  {
+    return m_options;
+  }
+
   const std::vector<std::string> get_keys()
   {
     std::vector<std::string> keys(m_data.size());
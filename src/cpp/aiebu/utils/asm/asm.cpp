@@ -29,9 +29,9 @@ void main_helper(int argc, char** argv,
       .add_options()
       ("h,help", "show help message and exit", cxxopts::value<bool>()->default_value("false"))
 #ifdef AIEBU_FULL
-      ("t,target", "supported targets aie2ps/aie2asm/aie2txn/aie2dpu", cxxopts::value<decltype(target_name)>())
+      ("t,target", "supported targets aie2ps/aie2asm/aie2txn/aie2dpu/aie2update", cxxopts::value<decltype(target_name)>())
 #else
-      ("t,target", "supported targets aie2txn/aie2dpu/aie2asm", cxxopts::value<decltype(target_name)>())
+      ("t,target", "supported targets aie2txn/aie2dpu/aie2asm/aie2update", cxxopts::value<decltype(target_name)>())
 #endif
     ;
 
@@ -88,6 +88,7 @@ int main( int argc, char** argv )
     targets.emplace_back(std::make_shared<aiebu::utilities::target_aie2>(executable));
     targets.emplace_back(std::make_shared<aiebu::utilities::target_aie2blob_transaction>(executable));
     targets.emplace_back(std::make_shared<aiebu::utilities::target_aie2blob_dpu>(executable));
+    targets.emplace_back(std::make_shared<aiebu::utilities::target_aie2update>(executable));
   }
 
   // -- Program Description
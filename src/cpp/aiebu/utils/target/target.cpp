@@ -47,6 +47,7 @@ target_aie2blob::parseOption(const sub_cmd_options &_options)
             ("L,libpath", "libs path", cxxopts::value<decltype(m_libpaths)>())
             ("m,pmctrl", "pm ctrlpkt <id>:<file>", cxxopts::value<decltype(pm_key_value_pairs)>())
             ("r,report", "Generate Report", cxxopts::value<bool>()->default_value("false"))
+            ("f,flag", "assembler flag <name>[=<value>], e.g. packed_reloc, dynsym_hash, elf64, include_cache, incremental, dedup_sections, dedup_data, resolve=<arg>:<addr>[;...], pagination=<greedy|ffd|exec>", cxxopts::value<decltype(m_flags)>())
             ("h,help", "show help message and exit", cxxopts::value<bool>()->default_value("false"))
     ;
 
@@ -85,6 +86,9 @@ target_aie2blob::parseOption(const sub_cmd_options &_options)
     if (result.count("report"))
       m_print_report = result["report"].as<decltype(m_print_report)>();
 
+    if (result.count("flag"))
+      m_flags = result["flag"].as<decltype(m_flags)>();
+
   }
   catch (const cxxopts::exceptions::exception& e) {
     std::cout << all_options.help({"", "Target aie2blob Options"});
@@ -115,10 +119,15 @@ target_aie2blob_dpu::assemble(const sub_cmd_options &_options)
   try {
     aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::blob_instr_dpu,
                               m_transaction_buffer, m_control_packet_buffer, m_patch_data_buffer,
-                              m_libs, m_libpaths);
+                              m_libs, m_libpaths, {}, m_flags);
     write_elf(as, m_output_elffile);
-    if (m_print_report)
-      as.get_report(std::cout);
+    if (!m_print_report)
+      return;
+
+    as.get_report(std::cout);
+    std::filesystem::path root_path(m_output_elffile);
+    root_path.replace_extension();
+    as.disassemble(root_path);
   } catch (aiebu::error &ex) {
     auto errMsg = boost::format("Error: %s, code:%d\n") % ex.what() % ex.get_code() ;
     throw std::runtime_error(errMsg.str());
@@ -135,7 +144,7 @@ target_aie2blob_transaction::assemble(const sub_cmd_options &_options)
   try {
     aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::blob_instr_transaction,
                               m_transaction_buffer, m_control_packet_buffer, m_patch_data_buffer,
-                              m_libs, m_libpaths, m_ctrlpkt);
+                              m_libs, m_libpaths, m_ctrlpkt, m_flags);
     write_elf(as, m_output_elffile);
     if (!m_print_report)
       return;
@@ -160,7 +169,7 @@ target_aie2::assemble(const sub_cmd_options &_options)
   try {
     aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2,
                               m_transaction_buffer, m_control_packet_buffer, m_patch_data_buffer,
-                              m_libs, m_libpaths, m_ctrlpkt);
+                              m_libs, m_libpaths, m_ctrlpkt, m_flags);
     write_elf(as, m_output_elffile);
 
     if (!m_print_report)
@@ -176,24 +185,113 @@ target_aie2::assemble(const sub_cmd_options &_options)
   }
 }
 
+bool
+aiebu::utilities::
+target_aie2update::parseUpdateOption(const sub_cmd_options &_options)
+{
+  std::vector<std::string> pm_key_value_pairs;
+  cxxopts::Options all_options("Target aie2update Options", m_description);
+
+  try {
+    all_options.add_options()
+            ("o,outputelf", "ELF output file name", cxxopts::value<decltype(m_output_elffile)>())
+            ("e,elf", "aie2 ELF to update", cxxopts::value<decltype(m_input_elffile)>())
+            ("p,controlpkt", "replacement control packet binary", cxxopts::value<decltype(m_controlpkt_file)>())
+            ("j,json", "replacement control packet patching json file", cxxopts::value<decltype(m_external_buffers_file)>())
+            ("m,pmctrl", "replacement pm ctrlpkt <id>:<file>", cxxopts::value<decltype(pm_key_value_pairs)>())
+            ("h,help", "show help message and exit", cxxopts::value<bool>()->default_value("false"))
+    ;
+
+    auto char_ver = aiebu::utilities::vector_of_string_to_vector_of_char(_options);
+
+    auto result = all_options.parse(char_ver.size(), char_ver.data());
+
+    if (result.count("help")) {
+      std::cout << all_options.help({"", "Target aie2update Options"});
+      return false;
+    }
+
+    if (result.count("outputelf"))
+      m_output_elffile = result["outputelf"].as<decltype(m_output_elffile)>();
+    else
+      throw std::runtime_error("the option '--outputelf' is required but missing\n");
+
+    if (result.count("elf"))
+      m_input_elffile = result["elf"].as<decltype(m_input_elffile)>();
+    else
+      throw std::runtime_error("the option '--elf' is required but missing\n");
+
+    if (result.count("controlpkt"))
+      m_controlpkt_file = result["controlpkt"].as<decltype(m_controlpkt_file)>();
+
+    if (result.count("json"))
+      m_external_buffers_file = result["json"].as<decltype(m_external_buffers_file)>();
+
+    if (result.count("pmctrl"))
+      pm_key_value_pairs = result["pmctrl"].as<decltype(pm_key_value_pairs)>();
+  }
+  catch (const cxxopts::exceptions::exception& e) {
+    std::cout << all_options.help({"", "Target aie2update Options"});
+    auto errMsg = boost::format("Error parsing options: %s\n") % e.what() ;
+    throw std::runtime_error(errMsg.str());
+  }
+
+  readfile(m_input_elffile, m_elf_buffer);
+
+  m_ctrlpkt = parse_pmctrlpkt(pm_key_value_pairs);
+
+  if (!m_controlpkt_file.empty())
+    readfile(m_controlpkt_file, m_control_packet_buffer);
+
+  if (!m_external_buffers_file.empty())
+    readfile(m_external_buffers_file, m_patch_data_buffer);
+
+  return true;
+}
+
+void
+aiebu::utilities::
+target_aie2update::assemble(const sub_cmd_options &_options)
+{
+  if (!parseUpdateOption(_options))
+    return;
+
+  try {
+    auto e = aiebu::aiebu_assembler::update_elf(m_elf_buffer, m_control_packet_buffer,
+                                                m_patch_data_buffer, m_ctrlpkt);
+    std::cout << "elf size:" << e.size() << "\n";
+    std::ofstream output_file(m_output_elffile, std::ios_base::binary);
+    output_file.write(e.data(), e.size());
+  } catch (aiebu::error &ex) {
+    auto errMsg = boost::format("Error: %s, code:%d\n") % ex.what() % ex.get_code() ;
+    throw std::runtime_error(errMsg.str());
+  }
+}
+
 #ifdef AIEBU_FULL
 void
 aiebu::utilities::
 target_aie2ps::assemble(const sub_cmd_options &_options)
 {
   std::string output_elffile;
-  std::string input_file;
+  std::vector<std::string> input_files;
   std::string external_buffers_file;
   std::vector<std::string> libpaths;
+  std::vector<std::string> flags;
+  bool object = false;
+  bool page_report = false;
 
   cxxopts::Options all_options("Target aie2ps Options", m_description);
 
   try {
     all_options.add_options()
             ("outputelf,o", "ELF output file name", cxxopts::value<decltype(output_elffile)>())
-            ("asm,c", "ASM File", cxxopts::value<decltype(input_file)>())
+            ("asm,c", "ASM File or object written with --object, repeat to link several units", cxxopts::value<decltype(input_files)>())
+            ("object", "write a binary object of the parsed ASM instead of an ELF", cxxopts::value<bool>()->default_value("false"))
+            ("page-report", "print how full each page is and why it was concluded", cxxopts::value<bool>()->default_value("false"))
             ("j,json", "control packet Patching json file", cxxopts::value<decltype(external_buffers_file)>())
             ("L,libpath", "libs path", cxxopts::value<decltype(libpaths)>())
+            ("f,flag", "assembler flag <name>[=<value>], e.g. packed_reloc, dynsym_hash, elf64, include_cache, incremental, dedup_sections, dedup_data, resolve=<arg>:<addr>[;...], pagination=<greedy|ffd|exec>", cxxopts::value<decltype(flags)>())
             ("help,h", "show help message and exit", cxxopts::value<bool>()->default_value("false"))
     ;
 
@@ -213,7 +311,7 @@ target_aie2ps::assemble(const sub_cmd_options &_options)
     }
 
     if (result.count("asm"))
-      input_file = result["asm"].as<decltype(input_file)>();
+      input_files = result["asm"].as<decltype(input_files)>();
     else
     {
       throw std::runtime_error("the option '--asm' is required but missing\n");
@@ -225,6 +323,12 @@ target_aie2ps::assemble(const sub_cmd_options &_options)
     if (result.count("json"))
       external_buffers_file = result["json"].as<decltype(external_buffers_file)>();
 
+    if (result.count("flag"))
+      flags = result["flag"].as<decltype(flags)>();
+
+    object = result["object"].as<bool>();
+    page_report = result["page-report"].as<bool>();
+
   }
   catch (const cxxopts::exceptions::exception& e) {
     std::cout << all_options.help({"", "Target aie2ps Options"});
@@ -232,8 +336,9 @@ target_aie2ps::assemble(const sub_cmd_options &_options)
     throw std::runtime_error(errMsg.str());
   }
 
-  std::vector<char> asmBuffer;
-  readfile(input_file, asmBuffer);
+  std::vector<std::vector<char>> asmBuffers(input_files.size());
+  for (size_t i = 0; i < input_files.size(); ++i)
+    readfile(input_files[i], asmBuffers[i]);
 
 
   std::vector<char> patch_data_buffer;
@@ -241,8 +346,30 @@ target_aie2ps::assemble(const sub_cmd_options &_options)
     readfile(external_buffers_file, patch_data_buffer);
 
   try {
-    aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, asmBuffer, {}, libpaths, patch_data_buffer);
+    if (object) {
+      auto o = (asmBuffers.size() == 1) ? aiebu::aiebu_assembler::get_object(asmBuffers[0], libpaths)
+                                        : aiebu::aiebu_assembler::link_objects(asmBuffers, libpaths);
+      std::cout << "object size:" << o.size() << "\n";
+      std::ofstream output_file(output_elffile, std::ios_base::binary);
+      output_file.write(o.data(), o.size());
+      return;
+    }
+    if (asmBuffers.size() > 1) {
+      aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, asmBuffers, patch_data_buffer,
+                                libpaths, flags);
+      write_elf(as, output_elffile);
+      if (page_report)
+        aiebu::aiebu_assembler::print_page_report(
+          aiebu::aiebu_assembler::get_page_report(aiebu::aiebu_assembler::link_objects(asmBuffers, libpaths),
+                                                  libpaths, flags), std::cout);
+      return;
+    }
+    aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, asmBuffers[0], {}, patch_data_buffer,
+                              {}, libpaths, {}, flags);
     write_elf(as, output_elffile);
+    if (page_report)
+      aiebu::aiebu_assembler::print_page_report(
+        aiebu::aiebu_assembler::get_page_report(asmBuffers[0], libpaths, flags), std::cout);
   } catch (aiebu::error &ex) {
     auto errMsg = boost::format("Error: %s, code:%d\n") % ex.what() % ex.get_code() ;
     throw std::runtime_error(errMsg.str());
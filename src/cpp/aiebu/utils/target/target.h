@@ -83,6 +83,7 @@ class target_aie2blob: public target
   std::vector<char> m_patch_data_buffer;
   std::vector<std::string> m_libs;
   std::vector<std::string> m_libpaths;
+  std::vector<std::string> m_flags;
   std::map<uint8_t, std::vector<char> > m_ctrlpkt;
   std::string m_output_elffile;
   bool m_print_report = false;
@@ -118,6 +119,18 @@ class target_aie2blob_dpu: public target_aie2blob
   virtual void assemble(const sub_cmd_options &_options);
 };
 
+class target_aie2update: public target_aie2blob
+{
+  std::string m_input_elffile;
+  std::vector<char> m_elf_buffer;
+  bool parseUpdateOption(const sub_cmd_options &_options);
+
+  public:
+  target_aie2update(const std::string& exename)
+    : target_aie2blob(exename, "aie2update", "aie2 ELF update, replace control packets or patch json") {}
+  virtual void assemble(const sub_cmd_options &_options);
+};
+
 } //namespace aiebu::utilities
 
 #endif //__AIEBU_UTILITIES_TARGET_H_
@@ -0,0 +1,25 @@
+;  [2] .ctrltext	72
+00000000: OP_WRITE32                       col 0, row 2
+    .long 0x02000200
+    .long 0x0001d004
+    .long 0x00000001
+0000000c: OP_WRITESHIMBD                   col 0, row 0
+    .long 0x0b000000
+    .long 0x80000000
+    .long 0x80000001
+    .long 0x80000002
+    .long 0x80000003
+    .long 0x80000004
+    .long 0x80000005
+    .long 0x80000006
+    .long 0x80000007
+00000030: OP_SYNC                          col 0, row 2
+    .long 0x03000200
+    .long 0x00010001
+00000038: OP_NOOP                          col 0, row 0
+    .long 0x00000000
+0000003c: OP_DUMP_REGISTER                 col 0, row 0
+    .long 0x12000000
+    .long 0x00000001
+    .long 0x0001d000
+
@@ -0,0 +1,31 @@
+;
+; uC DMA BDs loading each other in a cycle bd_a -> bd_b -> bd_c -> bd_a,
+; each job starts the chain at a different BD on its own page and every
+; page needs all three BDs
+;
+.attach_to_group 0
+START_JOB 0
+  uC_DMA_WRITE_DES_SYNC @bd_a
+END_JOB
+
+.eop
+
+START_JOB 1
+  uC_DMA_WRITE_DES_SYNC @bd_b
+END_JOB
+
+.eop
+
+START_JOB 2
+  uC_DMA_WRITE_DES_SYNC @bd_c
+END_JOB
+
+EOF
+
+  .align             16
+bd_a:
+  UC_DMA_BD         0, 0x001A0000, @bd_b, 4, 0, 0
+bd_b:
+  UC_DMA_BD         0, 0x001A0010, @bd_c, 4, 0, 0
+bd_c:
+  UC_DMA_BD         0, 0x001A0020, @bd_a, 4, 0, 0
@@ -0,0 +1,60 @@
+;
+; tbl_a and tbl_b have the same BD words but are patched with different
+; args, tbl_c and tbl_d are the same and not patched. With dedup_data only
+; tbl_d is merged into tbl_c.
+;
+.attach_to_group 0
+START_JOB 0
+  APPLY_OFFSET_57     @tbl_a, 1, 1
+  APPLY_OFFSET_57     @tbl_b, 1, 2
+  uC_DMA_WRITE_DES_SYNC @bd_a
+  uC_DMA_WRITE_DES_SYNC @bd_b
+END_JOB
+
+EOF
+
+  .align             16
+bd_a:
+  UC_DMA_BD         0, 0x001D0000, @tbl_a, 8, 0, 1
+  UC_DMA_BD         0, 0x001D0020, @tbl_c, 8, 0, 0
+bd_b:
+  UC_DMA_BD         0, 0x001D0000, @tbl_b, 8, 0, 1
+  UC_DMA_BD         0, 0x001D0020, @tbl_d, 8, 0, 0
+
+  .align             4
+tbl_a:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+tbl_b:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+tbl_c:
+  .long              0x00000100
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+tbl_d:
+  .long              0x00000100
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
@@ -0,0 +1,91 @@
+;
+; col 0 and col 1 run the same program, their pages are byte identical
+;
+.attach_to_group 0
+START_JOB 0
+  uC_DMA_WRITE_DES    $r0, @uc_dma_bd0
+  WAIT_uC_DMA         $r0
+  LOCAL_BARRIER       $lb0, 2
+END_JOB
+
+START_JOB 1
+  LOCAL_BARRIER       $lb0, 2
+  WRITE_32            0x81A0634, 0x80000000
+  WRITE_32            0xA1A0604, 0x80000000
+  WAIT_TCTS           TILE_4_1, MEM_MM2S_0, 1
+  WAIT_TCTS           TILE_5_1, MEM_S2MM_0, 1
+END_JOB
+
+EOF
+
+  .align             16
+uc_dma_bd0:
+  UC_DMA_BD         0, 0x081A0000, @mem_bd0, 8, 0, 1
+  UC_DMA_BD         0, 0x0A1A0000, @mem_bd1, 8, 0, 0
+
+  .align             4
+mem_bd0:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+
+  .align             4
+mem_bd1:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+
+.section .ctrltext
+.attach_to_group 1
+START_JOB 0
+  uC_DMA_WRITE_DES    $r0, @uc_dma_bd0
+  WAIT_uC_DMA         $r0
+  LOCAL_BARRIER       $lb0, 2
+END_JOB
+
+START_JOB 1
+  LOCAL_BARRIER       $lb0, 2
+  WRITE_32            0x81A0634, 0x80000000
+  WRITE_32            0xA1A0604, 0x80000000
+  WAIT_TCTS           TILE_4_1, MEM_MM2S_0, 1
+  WAIT_TCTS           TILE_5_1, MEM_S2MM_0, 1
+END_JOB
+
+EOF
+
+  .align             16
+uc_dma_bd0:
+  UC_DMA_BD         0, 0x081A0000, @mem_bd0, 8, 0, 1
+  UC_DMA_BD         0, 0x0A1A0000, @mem_bd1, 8, 0, 0
+
+  .align             4
+mem_bd0:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
+
+  .align             4
+mem_bd1:
+  .long              0x00000080
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x00000000
+  .long              0x80000000
@@ -0,0 +1,1031 @@
+;
+; Two launch chains 0 -> 2 -> 4 and 1 -> 3 -> 5. Jobs 2 and 3 have 300
+; WRITE_32 (about 45% of a page), jobs 4 and 5 have 200. In source order
+; jobs 0 to 3 share the first page and jobs 4 and 5 the second one, each
+; chain switches pages twice on its way. Paginated along the execution path
+; each chain gets its own page.
+;
+.attach_to_group 0
+START_JOB 0
+  LAUNCH_JOB          2
+END_JOB
+
+START_JOB 1
+  LAUNCH_JOB          3
+END_JOB
+
+START_JOB_DEFERRED 2
+  LAUNCH_JOB          4
+  WRITE_32            0x41A0000, 0x2000
+  WRITE_32            0x41A0004, 0x2001
+  WRITE_32            0x41A0008, 0x2002
+  WRITE_32            0x41A000C, 0x2003
+  WRITE_32            0x41A0010, 0x2004
+  WRITE_32            0x41A0014, 0x2005
+  WRITE_32            0x41A0018, 0x2006
+  WRITE_32            0x41A001C, 0x2007
+  WRITE_32            0x41A0020, 0x2008
+  WRITE_32            0x41A0024, 0x2009
+  WRITE_32            0x41A0028, 0x200A
+  WRITE_32            0x41A002C, 0x200B
+  WRITE_32            0x41A0030, 0x200C
+  WRITE_32            0x41A0034, 0x200D
+  WRITE_32            0x41A0038, 0x200E
+  WRITE_32            0x41A003C, 0x200F
+  WRITE_32            0x41A0040, 0x2010
+  WRITE_32            0x41A0044, 0x2011
+  WRITE_32            0x41A0048, 0x2012
+  WRITE_32            0x41A004C, 0x2013
+  WRITE_32            0x41A0050, 0x2014
+  WRITE_32            0x41A0054, 0x2015
+  WRITE_32            0x41A0058, 0x2016
+  WRITE_32            0x41A005C, 0x2017
+  WRITE_32            0x41A0060, 0x2018
+  WRITE_32            0x41A0064, 0x2019
+  WRITE_32            0x41A0068, 0x201A
+  WRITE_32            0x41A006C, 0x201B
+  WRITE_32            0x41A0070, 0x201C
+  WRITE_32            0x41A0074, 0x201D
+  WRITE_32            0x41A0078, 0x201E
+  WRITE_32            0x41A007C, 0x201F
+  WRITE_32            0x41A0080, 0x2020
+  WRITE_32            0x41A0084, 0x2021
+  WRITE_32            0x41A0088, 0x2022
+  WRITE_32            0x41A008C, 0x2023
+  WRITE_32            0x41A0090, 0x2024
+  WRITE_32            0x41A0094, 0x2025
+  WRITE_32            0x41A0098, 0x2026
+  WRITE_32            0x41A009C, 0x2027
+  WRITE_32            0x41A00A0, 0x2028
+  WRITE_32            0x41A00A4, 0x2029
+  WRITE_32            0x41A00A8, 0x202A
+  WRITE_32            0x41A00AC, 0x202B
+  WRITE_32            0x41A00B0, 0x202C
+  WRITE_32            0x41A00B4, 0x202D
+  WRITE_32            0x41A00B8, 0x202E
+  WRITE_32            0x41A00BC, 0x202F
+  WRITE_32            0x41A00C0, 0x2030
+  WRITE_32            0x41A00C4, 0x2031
+  WRITE_32            0x41A00C8, 0x2032
+  WRITE_32            0x41A00CC, 0x2033
+  WRITE_32            0x41A00D0, 0x2034
+  WRITE_32            0x41A00D4, 0x2035
+  WRITE_32            0x41A00D8, 0x2036
+  WRITE_32            0x41A00DC, 0x2037
+  WRITE_32            0x41A00E0, 0x2038
+  WRITE_32            0x41A00E4, 0x2039
+  WRITE_32            0x41A00E8, 0x203A
+  WRITE_32            0x41A00EC, 0x203B
+  WRITE_32            0x41A00F0, 0x203C
+  WRITE_32            0x41A00F4, 0x203D
+  WRITE_32            0x41A00F8, 0x203E
+  WRITE_32            0x41A00FC, 0x203F
+  WRITE_32            0x41A0100, 0x2040
+  WRITE_32            0x41A0104, 0x2041
+  WRITE_32            0x41A0108, 0x2042
+  WRITE_32            0x41A010C, 0x2043
+  WRITE_32            0x41A0110, 0x2044
+  WRITE_32            0x41A0114, 0x2045
+  WRITE_32            0x41A0118, 0x2046
+  WRITE_32            0x41A011C, 0x2047
+  WRITE_32            0x41A0120, 0x2048
+  WRITE_32            0x41A0124, 0x2049
+  WRITE_32            0x41A0128, 0x204A
+  WRITE_32            0x41A012C, 0x204B
+  WRITE_32            0x41A0130, 0x204C
+  WRITE_32            0x41A0134, 0x204D
+  WRITE_32            0x41A0138, 0x204E
+  WRITE_32            0x41A013C, 0x204F
+  WRITE_32            0x41A0140, 0x2050
+  WRITE_32            0x41A0144, 0x2051
+  WRITE_32            0x41A0148, 0x2052
+  WRITE_32            0x41A014C, 0x2053
+  WRITE_32            0x41A0150, 0x2054
+  WRITE_32            0x41A0154, 0x2055
+  WRITE_32            0x41A0158, 0x2056
+  WRITE_32            0x41A015C, 0x2057
+  WRITE_32            0x41A0160, 0x2058
+  WRITE_32            0x41A0164, 0x2059
+  WRITE_32            0x41A0168, 0x205A
+  WRITE_32            0x41A016C, 0x205B
+  WRITE_32            0x41A0170, 0x205C
+  WRITE_32            0x41A0174, 0x205D
+  WRITE_32            0x41A0178, 0x205E
+  WRITE_32            0x41A017C, 0x205F
+  WRITE_32            0x41A0180, 0x2060
+  WRITE_32            0x41A0184, 0x2061
+  WRITE_32            0x41A0188, 0x2062
+  WRITE_32            0x41A018C, 0x2063
+  WRITE_32            0x41A0190, 0x2064
+  WRITE_32            0x41A0194, 0x2065
+  WRITE_32            0x41A0198, 0x2066
+  WRITE_32            0x41A019C, 0x2067
+  WRITE_32            0x41A01A0, 0x2068
+  WRITE_32            0x41A01A4, 0x2069
+  WRITE_32            0x41A01A8, 0x206A
+  WRITE_32            0x41A01AC, 0x206B
+  WRITE_32            0x41A01B0, 0x206C
+  WRITE_32            0x41A01B4, 0x206D
+  WRITE_32            0x41A01B8, 0x206E
+  WRITE_32            0x41A01BC, 0x206F
+  WRITE_32            0x41A01C0, 0x2070
+  WRITE_32            0x41A01C4, 0x2071
+  WRITE_32            0x41A01C8, 0x2072
+  WRITE_32            0x41A01CC, 0x2073
+  WRITE_32            0x41A01D0, 0x2074
+  WRITE_32            0x41A01D4, 0x2075
+  WRITE_32            0x41A01D8, 0x2076
+  WRITE_32            0x41A01DC, 0x2077
+  WRITE_32            0x41A01E0, 0x2078
+  WRITE_32            0x41A01E4, 0x2079
+  WRITE_32            0x41A01E8, 0x207A
+  WRITE_32            0x41A01EC, 0x207B
+  WRITE_32            0x41A01F0, 0x207C
+  WRITE_32            0x41A01F4, 0x207D
+  WRITE_32            0x41A01F8, 0x207E
+  WRITE_32            0x41A01FC, 0x207F
+  WRITE_32            0x41A0200, 0x2080
+  WRITE_32            0x41A0204, 0x2081
+  WRITE_32            0x41A0208, 0x2082
+  WRITE_32            0x41A020C, 0x2083
+  WRITE_32            0x41A0210, 0x2084
+  WRITE_32            0x41A0214, 0x2085
+  WRITE_32            0x41A0218, 0x2086
+  WRITE_32            0x41A021C, 0x2087
+  WRITE_32            0x41A0220, 0x2088
+  WRITE_32            0x41A0224, 0x2089
+  WRITE_32            0x41A0228, 0x208A
+  WRITE_32            0x41A022C, 0x208B
+  WRITE_32            0x41A0230, 0x208C
+  WRITE_32            0x41A0234, 0x208D
+  WRITE_32            0x41A0238, 0x208E
+  WRITE_32            0x41A023C, 0x208F
+  WRITE_32            0x41A0240, 0x2090
+  WRITE_32            0x41A0244, 0x2091
+  WRITE_32            0x41A0248, 0x2092
+  WRITE_32            0x41A024C, 0x2093
+  WRITE_32            0x41A0250, 0x2094
+  WRITE_32            0x41A0254, 0x2095
+  WRITE_32            0x41A0258, 0x2096
+  WRITE_32            0x41A025C, 0x2097
+  WRITE_32            0x41A0260, 0x2098
+  WRITE_32            0x41A0264, 0x2099
+  WRITE_32            0x41A0268, 0x209A
+  WRITE_32            0x41A026C, 0x209B
+  WRITE_32            0x41A0270, 0x209C
+  WRITE_32            0x41A0274, 0x209D
+  WRITE_32            0x41A0278, 0x209E
+  WRITE_32            0x41A027C, 0x209F
+  WRITE_32            0x41A0280, 0x20A0
+  WRITE_32            0x41A0284, 0x20A1
+  WRITE_32            0x41A0288, 0x20A2
+  WRITE_32            0x41A028C, 0x20A3
+  WRITE_32            0x41A0290, 0x20A4
+  WRITE_32            0x41A0294, 0x20A5
+  WRITE_32            0x41A0298, 0x20A6
+  WRITE_32            0x41A029C, 0x20A7
+  WRITE_32            0x41A02A0, 0x20A8
+  WRITE_32            0x41A02A4, 0x20A9
+  WRITE_32            0x41A02A8, 0x20AA
+  WRITE_32            0x41A02AC, 0x20AB
+  WRITE_32            0x41A02B0, 0x20AC
+  WRITE_32            0x41A02B4, 0x20AD
+  WRITE_32            0x41A02B8, 0x20AE
+  WRITE_32            0x41A02BC, 0x20AF
+  WRITE_32            0x41A02C0, 0x20B0
+  WRITE_32            0x41A02C4, 0x20B1
+  WRITE_32            0x41A02C8, 0x20B2
+  WRITE_32            0x41A02CC, 0x20B3
+  WRITE_32            0x41A02D0, 0x20B4
+  WRITE_32            0x41A02D4, 0x20B5
+  WRITE_32            0x41A02D8, 0x20B6
+  WRITE_32            0x41A02DC, 0x20B7
+  WRITE_32            0x41A02E0, 0x20B8
+  WRITE_32            0x41A02E4, 0x20B9
+  WRITE_32            0x41A02E8, 0x20BA
+  WRITE_32            0x41A02EC, 0x20BB
+  WRITE_32            0x41A02F0, 0x20BC
+  WRITE_32            0x41A02F4, 0x20BD
+  WRITE_32            0x41A02F8, 0x20BE
+  WRITE_32            0x41A02FC, 0x20BF
+  WRITE_32            0x41A0300, 0x20C0
+  WRITE_32            0x41A0304, 0x20C1
+  WRITE_32            0x41A0308, 0x20C2
+  WRITE_32            0x41A030C, 0x20C3
+  WRITE_32            0x41A0310, 0x20C4
+  WRITE_32            0x41A0314, 0x20C5
+  WRITE_32            0x41A0318, 0x20C6
+  WRITE_32            0x41A031C, 0x20C7
+  WRITE_32            0x41A0320, 0x20C8
+  WRITE_32            0x41A0324, 0x20C9
+  WRITE_32            0x41A0328, 0x20CA
+  WRITE_32            0x41A032C, 0x20CB
+  WRITE_32            0x41A0330, 0x20CC
+  WRITE_32            0x41A0334, 0x20CD
+  WRITE_32            0x41A0338, 0x20CE
+  WRITE_32            0x41A033C, 0x20CF
+  WRITE_32            0x41A0340, 0x20D0
+  WRITE_32            0x41A0344, 0x20D1
+  WRITE_32            0x41A0348, 0x20D2
+  WRITE_32            0x41A034C, 0x20D3
+  WRITE_32            0x41A0350, 0x20D4
+  WRITE_32            0x41A0354, 0x20D5
+  WRITE_32            0x41A0358, 0x20D6
+  WRITE_32            0x41A035C, 0x20D7
+  WRITE_32            0x41A0360, 0x20D8
+  WRITE_32            0x41A0364, 0x20D9
+  WRITE_32            0x41A0368, 0x20DA
+  WRITE_32            0x41A036C, 0x20DB
+  WRITE_32            0x41A0370, 0x20DC
+  WRITE_32            0x41A0374, 0x20DD
+  WRITE_32            0x41A0378, 0x20DE
+  WRITE_32            0x41A037C, 0x20DF
+  WRITE_32            0x41A0380, 0x20E0
+  WRITE_32            0x41A0384, 0x20E1
+  WRITE_32            0x41A0388, 0x20E2
+  WRITE_32            0x41A038C, 0x20E3
+  WRITE_32            0x41A0390, 0x20E4
+  WRITE_32            0x41A0394, 0x20E5
+  WRITE_32            0x41A0398, 0x20E6
+  WRITE_32            0x41A039C, 0x20E7
+  WRITE_32            0x41A03A0, 0x20E8
+  WRITE_32            0x41A03A4, 0x20E9
+  WRITE_32            0x41A03A8, 0x20EA
+  WRITE_32            0x41A03AC, 0x20EB
+  WRITE_32            0x41A03B0, 0x20EC
+  WRITE_32            0x41A03B4, 0x20ED
+  WRITE_32            0x41A03B8, 0x20EE
+  WRITE_32            0x41A03BC, 0x20EF
+  WRITE_32            0x41A03C0, 0x20F0
+  WRITE_32            0x41A03C4, 0x20F1
+  WRITE_32            0x41A03C8, 0x20F2
+  WRITE_32            0x41A03CC, 0x20F3
+  WRITE_32            0x41A03D0, 0x20F4
+  WRITE_32            0x41A03D4, 0x20F5
+  WRITE_32            0x41A03D8, 0x20F6
+  WRITE_32            0x41A03DC, 0x20F7
+  WRITE_32            0x41A03E0, 0x20F8
+  WRITE_32            0x41A03E4, 0x20F9
+  WRITE_32            0x41A03E8, 0x20FA
+  WRITE_32            0x41A03EC, 0x20FB
+  WRITE_32            0x41A03F0, 0x20FC
+  WRITE_32            0x41A03F4, 0x20FD
+  WRITE_32            0x41A03F8, 0x20FE
+  WRITE_32            0x41A03FC, 0x20FF
+  WRITE_32            0x41A0400, 0x2100
+  WRITE_32            0x41A0404, 0x2101
+  WRITE_32            0x41A0408, 0x2102
+  WRITE_32            0x41A040C, 0x2103
+  WRITE_32            0x41A0410, 0x2104
+  WRITE_32            0x41A0414, 0x2105
+  WRITE_32            0x41A0418, 0x2106
+  WRITE_32            0x41A041C, 0x2107
+  WRITE_32            0x41A0420, 0x2108
+  WRITE_32            0x41A0424, 0x2109
+  WRITE_32            0x41A0428, 0x210A
+  WRITE_32            0x41A042C, 0x210B
+  WRITE_32            0x41A0430, 0x210C
+  WRITE_32            0x41A0434, 0x210D
+  WRITE_32            0x41A0438, 0x210E
+  WRITE_32            0x41A043C, 0x210F
+  WRITE_32            0x41A0440, 0x2110
+  WRITE_32            0x41A0444, 0x2111
+  WRITE_32            0x41A0448, 0x2112
+  WRITE_32            0x41A044C, 0x2113
+  WRITE_32            0x41A0450, 0x2114
+  WRITE_32            0x41A0454, 0x2115
+  WRITE_32            0x41A0458, 0x2116
+  WRITE_32            0x41A045C, 0x2117
+  WRITE_32            0x41A0460, 0x2118
+  WRITE_32            0x41A0464, 0x2119
+  WRITE_32            0x41A0468, 0x211A
+  WRITE_32            0x41A046C, 0x211B
+  WRITE_32            0x41A0470, 0x211C
+  WRITE_32            0x41A0474, 0x211D
+  WRITE_32            0x41A0478, 0x211E
+  WRITE_32            0x41A047C, 0x211F
+  WRITE_32            0x41A0480, 0x2120
+  WRITE_32            0x41A0484, 0x2121
+  WRITE_32            0x41A0488, 0x2122
+  WRITE_32            0x41A048C, 0x2123
+  WRITE_32            0x41A0490, 0x2124
+  WRITE_32            0x41A0494, 0x2125
+  WRITE_32            0x41A0498, 0x2126
+  WRITE_32            0x41A049C, 0x2127
+  WRITE_32            0x41A04A0, 0x2128
+  WRITE_32            0x41A04A4, 0x2129
+  WRITE_32            0x41A04A8, 0x212A
+  WRITE_32            0x41A04AC, 0x212B
+END_JOB
+
+START_JOB_DEFERRED 3
+  LAUNCH_JOB          5
+  WRITE_32            0x61A0000, 0x3000
+  WRITE_32            0x61A0004, 0x3001
+  WRITE_32            0x61A0008, 0x3002
+  WRITE_32            0x61A000C, 0x3003
+  WRITE_32            0x61A0010, 0x3004
+  WRITE_32            0x61A0014, 0x3005
+  WRITE_32            0x61A0018, 0x3006
+  WRITE_32            0x61A001C, 0x3007
+  WRITE_32            0x61A0020, 0x3008
+  WRITE_32            0x61A0024, 0x3009
+  WRITE_32            0x61A0028, 0x300A
+  WRITE_32            0x61A002C, 0x300B
+  WRITE_32            0x61A0030, 0x300C
+  WRITE_32            0x61A0034, 0x300D
+  WRITE_32            0x61A0038, 0x300E
+  WRITE_32            0x61A003C, 0x300F
+  WRITE_32            0x61A0040, 0x3010
+  WRITE_32            0x61A0044, 0x3011
+  WRITE_32            0x61A0048, 0x3012
+  WRITE_32            0x61A004C, 0x3013
+  WRITE_32            0x61A0050, 0x3014
+  WRITE_32            0x61A0054, 0x3015
+  WRITE_32            0x61A0058, 0x3016
+  WRITE_32            0x61A005C, 0x3017
+  WRITE_32            0x61A0060, 0x3018
+  WRITE_32            0x61A0064, 0x3019
+  WRITE_32            0x61A0068, 0x301A
+  WRITE_32            0x61A006C, 0x301B
+  WRITE_32            0x61A0070, 0x301C
+  WRITE_32            0x61A0074, 0x301D
+  WRITE_32            0x61A0078, 0x301E
+  WRITE_32            0x61A007C, 0x301F
+  WRITE_32            0x61A0080, 0x3020
+  WRITE_32            0x61A0084, 0x3021
+  WRITE_32            0x61A0088, 0x3022
+  WRITE_32            0x61A008C, 0x3023
+  WRITE_32            0x61A0090, 0x3024
+  WRITE_32            0x61A0094, 0x3025
+  WRITE_32            0x61A0098, 0x3026
+  WRITE_32            0x61A009C, 0x3027
+  WRITE_32            0x61A00A0, 0x3028
+  WRITE_32            0x61A00A4, 0x3029
+  WRITE_32            0x61A00A8, 0x302A
+  WRITE_32            0x61A00AC, 0x302B
+  WRITE_32            0x61A00B0, 0x302C
+  WRITE_32            0x61A00B4, 0x302D
+  WRITE_32            0x61A00B8, 0x302E
+  WRITE_32            0x61A00BC, 0x302F
+  WRITE_32            0x61A00C0, 0x3030
+  WRITE_32            0x61A00C4, 0x3031
+  WRITE_32            0x61A00C8, 0x3032
+  WRITE_32            0x61A00CC, 0x3033
+  WRITE_32            0x61A00D0, 0x3034
+  WRITE_32            0x61A00D4, 0x3035
+  WRITE_32            0x61A00D8, 0x3036
+  WRITE_32            0x61A00DC, 0x3037
+  WRITE_32            0x61A00E0, 0x3038
+  WRITE_32            0x61A00E4, 0x3039
+  WRITE_32            0x61A00E8, 0x303A
+  WRITE_32            0x61A00EC, 0x303B
+  WRITE_32            0x61A00F0, 0x303C
+  WRITE_32            0x61A00F4, 0x303D
+  WRITE_32            0x61A00F8, 0x303E
+  WRITE_32            0x61A00FC, 0x303F
+  WRITE_32            0x61A0100, 0x3040
+  WRITE_32            0x61A0104, 0x3041
+  WRITE_32            0x61A0108, 0x3042
+  WRITE_32            0x61A010C, 0x3043
+  WRITE_32            0x61A0110, 0x3044
+  WRITE_32            0x61A0114, 0x3045
+  WRITE_32            0x61A0118, 0x3046
+  WRITE_32            0x61A011C, 0x3047
+  WRITE_32            0x61A0120, 0x3048
+  WRITE_32            0x61A0124, 0x3049
+  WRITE_32            0x61A0128, 0x304A
+  WRITE_32            0x61A012C, 0x304B
+  WRITE_32            0x61A0130, 0x304C
+  WRITE_32            0x61A0134, 0x304D
+  WRITE_32            0x61A0138, 0x304E
+  WRITE_32            0x61A013C, 0x304F
+  WRITE_32            0x61A0140, 0x3050
+  WRITE_32            0x61A0144, 0x3051
+  WRITE_32            0x61A0148, 0x3052
+  WRITE_32            0x61A014C, 0x3053
+  WRITE_32            0x61A0150, 0x3054
+  WRITE_32            0x61A0154, 0x3055
+  WRITE_32            0x61A0158, 0x3056
+  WRITE_32            0x61A015C, 0x3057
+  WRITE_32            0x61A0160, 0x3058
+  WRITE_32            0x61A0164, 0x3059
+  WRITE_32            0x61A0168, 0x305A
+  WRITE_32            0x61A016C, 0x305B
+  WRITE_32            0x61A0170, 0x305C
+  WRITE_32            0x61A0174, 0x305D
+  WRITE_32            0x61A0178, 0x305E
+  WRITE_32            0x61A017C, 0x305F
+  WRITE_32            0x61A0180, 0x3060
+  WRITE_32            0x61A0184, 0x3061
+  WRITE_32            0x61A0188, 0x3062
+  WRITE_32            0x61A018C, 0x3063
+  WRITE_32            0x61A0190, 0x3064
+  WRITE_32            0x61A0194, 0x3065
+  WRITE_32            0x61A0198, 0x3066
+  WRITE_32            0x61A019C, 0x3067
+  WRITE_32            0x61A01A0, 0x3068
+  WRITE_32            0x61A01A4, 0x3069
+  WRITE_32            0x61A01A8, 0x306A
+  WRITE_32            0x61A01AC, 0x306B
+  WRITE_32            0x61A01B0, 0x306C
+  WRITE_32            0x61A01B4, 0x306D
+  WRITE_32            0x61A01B8, 0x306E
+  WRITE_32            0x61A01BC, 0x306F
+  WRITE_32            0x61A01C0, 0x3070
+  WRITE_32            0x61A01C4, 0x3071
+  WRITE_32            0x61A01C8, 0x3072
+  WRITE_32            0x61A01CC, 0x3073
+  WRITE_32            0x61A01D0, 0x3074
+  WRITE_32            0x61A01D4, 0x3075
+  WRITE_32            0x61A01D8, 0x3076
+  WRITE_32            0x61A01DC, 0x3077
+  WRITE_32            0x61A01E0, 0x3078
+  WRITE_32            0x61A01E4, 0x3079
+  WRITE_32            0x61A01E8, 0x307A
+  WRITE_32            0x61A01EC, 0x307B
+  WRITE_32            0x61A01F0, 0x307C
+  WRITE_32            0x61A01F4, 0x307D
+  WRITE_32            0x61A01F8, 0x307E
+  WRITE_32            0x61A01FC, 0x307F
+  WRITE_32            0x61A0200, 0x3080
+  WRITE_32            0x61A0204, 0x3081
+  WRITE_32            0x61A0208, 0x3082
+  WRITE_32            0x61A020C, 0x3083
+  WRITE_32            0x61A0210, 0x3084
+  WRITE_32            0x61A0214, 0x3085
+  WRITE_32            0x61A0218, 0x3086
+  WRITE_32            0x61A021C, 0x3087
+  WRITE_32            0x61A0220, 0x3088
+  WRITE_32            0x61A0224, 0x3089
+  WRITE_32            0x61A0228, 0x308A
+  WRITE_32            0x61A022C, 0x308B
+  WRITE_32            0x61A0230, 0x308C
+  WRITE_32            0x61A0234, 0x308D
+  WRITE_32            0x61A0238, 0x308E
+  WRITE_32            0x61A023C, 0x308F
+  WRITE_32            0x61A0240, 0x3090
+  WRITE_32            0x61A0244, 0x3091
+  WRITE_32            0x61A0248, 0x3092
+  WRITE_32            0x61A024C, 0x3093
+  WRITE_32            0x61A0250, 0x3094
+  WRITE_32            0x61A0254, 0x3095
+  WRITE_32            0x61A0258, 0x3096
+  WRITE_32            0x61A025C, 0x3097
+  WRITE_32            0x61A0260, 0x3098
+  WRITE_32            0x61A0264, 0x3099
+  WRITE_32            0x61A0268, 0x309A
+  WRITE_32            0x61A026C, 0x309B
+  WRITE_32            0x61A0270, 0x309C
+  WRITE_32            0x61A0274, 0x309D
+  WRITE_32            0x61A0278, 0x309E
+  WRITE_32            0x61A027C, 0x309F
+  WRITE_32            0x61A0280, 0x30A0
+  WRITE_32            0x61A0284, 0x30A1
+  WRITE_32            0x61A0288, 0x30A2
+  WRITE_32            0x61A028C, 0x30A3
+  WRITE_32            0x61A0290, 0x30A4
+  WRITE_32            0x61A0294, 0x30A5
+  WRITE_32            0x61A0298, 0x30A6
+  WRITE_32            0x61A029C, 0x30A7
+  WRITE_32            0x61A02A0, 0x30A8
+  WRITE_32            0x61A02A4, 0x30A9
+  WRITE_32            0x61A02A8, 0x30AA
+  WRITE_32            0x61A02AC, 0x30AB
+  WRITE_32            0x61A02B0, 0x30AC
+  WRITE_32            0x61A02B4, 0x30AD
+  WRITE_32            0x61A02B8, 0x30AE
+  WRITE_32            0x61A02BC, 0x30AF
+  WRITE_32            0x61A02C0, 0x30B0
+  WRITE_32            0x61A02C4, 0x30B1
+  WRITE_32            0x61A02C8, 0x30B2
+  WRITE_32            0x61A02CC, 0x30B3
+  WRITE_32            0x61A02D0, 0x30B4
+  WRITE_32            0x61A02D4, 0x30B5
+  WRITE_32            0x61A02D8, 0x30B6
+  WRITE_32            0x61A02DC, 0x30B7
+  WRITE_32            0x61A02E0, 0x30B8
+  WRITE_32            0x61A02E4, 0x30B9
+  WRITE_32            0x61A02E8, 0x30BA
+  WRITE_32            0x61A02EC, 0x30BB
+  WRITE_32            0x61A02F0, 0x30BC
+  WRITE_32            0x61A02F4, 0x30BD
+  WRITE_32            0x61A02F8, 0x30BE
+  WRITE_32            0x61A02FC, 0x30BF
+  WRITE_32            0x61A0300, 0x30C0
+  WRITE_32            0x61A0304, 0x30C1
+  WRITE_32            0x61A0308, 0x30C2
+  WRITE_32            0x61A030C, 0x30C3
+  WRITE_32            0x61A0310, 0x30C4
+  WRITE_32            0x61A0314, 0x30C5
+  WRITE_32            0x61A0318, 0x30C6
+  WRITE_32            0x61A031C, 0x30C7
+  WRITE_32            0x61A0320, 0x30C8
+  WRITE_32            0x61A0324, 0x30C9
+  WRITE_32            0x61A0328, 0x30CA
+  WRITE_32            0x61A032C, 0x30CB
+  WRITE_32            0x61A0330, 0x30CC
+  WRITE_32            0x61A0334, 0x30CD
+  WRITE_32            0x61A0338, 0x30CE
+  WRITE_32            0x61A033C, 0x30CF
+  WRITE_32            0x61A0340, 0x30D0
+  WRITE_32            0x61A0344, 0x30D1
+  WRITE_32            0x61A0348, 0x30D2
+  WRITE_32            0x61A034C, 0x30D3
+  WRITE_32            0x61A0350, 0x30D4
+  WRITE_32            0x61A0354, 0x30D5
+  WRITE_32            0x61A0358, 0x30D6
+  WRITE_32            0x61A035C, 0x30D7
+  WRITE_32            0x61A0360, 0x30D8
+  WRITE_32            0x61A0364, 0x30D9
+  WRITE_32            0x61A0368, 0x30DA
+  WRITE_32            0x61A036C, 0x30DB
+  WRITE_32            0x61A0370, 0x30DC
+  WRITE_32            0x61A0374, 0x30DD
+  WRITE_32            0x61A0378, 0x30DE
+  WRITE_32            0x61A037C, 0x30DF
+  WRITE_32            0x61A0380, 0x30E0
+  WRITE_32            0x61A0384, 0x30E1
+  WRITE_32            0x61A0388, 0x30E2
+  WRITE_32            0x61A038C, 0x30E3
+  WRITE_32            0x61A0390, 0x30E4
+  WRITE_32            0x61A0394, 0x30E5
+  WRITE_32            0x61A0398, 0x30E6
+  WRITE_32            0x61A039C, 0x30E7
+  WRITE_32            0x61A03A0, 0x30E8
+  WRITE_32            0x61A03A4, 0x30E9
+  WRITE_32            0x61A03A8, 0x30EA
+  WRITE_32            0x61A03AC, 0x30EB
+  WRITE_32            0x61A03B0, 0x30EC
+  WRITE_32            0x61A03B4, 0x30ED
+  WRITE_32            0x61A03B8, 0x30EE
+  WRITE_32            0x61A03BC, 0x30EF
+  WRITE_32            0x61A03C0, 0x30F0
+  WRITE_32            0x61A03C4, 0x30F1
+  WRITE_32            0x61A03C8, 0x30F2
+  WRITE_32            0x61A03CC, 0x30F3
+  WRITE_32            0x61A03D0, 0x30F4
+  WRITE_32            0x61A03D4, 0x30F5
+  WRITE_32            0x61A03D8, 0x30F6
+  WRITE_32            0x61A03DC, 0x30F7
+  WRITE_32            0x61A03E0, 0x30F8
+  WRITE_32            0x61A03E4, 0x30F9
+  WRITE_32            0x61A03E8, 0x30FA
+  WRITE_32            0x61A03EC, 0x30FB
+  WRITE_32            0x61A03F0, 0x30FC
+  WRITE_32            0x61A03F4, 0x30FD
+  WRITE_32            0x61A03F8, 0x30FE
+  WRITE_32            0x61A03FC, 0x30FF
+  WRITE_32            0x61A0400, 0x3100
+  WRITE_32            0x61A0404, 0x3101
+  WRITE_32            0x61A0408, 0x3102
+  WRITE_32            0x61A040C, 0x3103
+  WRITE_32            0x61A0410, 0x3104
+  WRITE_32            0x61A0414, 0x3105
+  WRITE_32            0x61A0418, 0x3106
+  WRITE_32            0x61A041C, 0x3107
+  WRITE_32            0x61A0420, 0x3108
+  WRITE_32            0x61A0424, 0x3109
+  WRITE_32            0x61A0428, 0x310A
+  WRITE_32            0x61A042C, 0x310B
+  WRITE_32            0x61A0430, 0x310C
+  WRITE_32            0x61A0434, 0x310D
+  WRITE_32            0x61A0438, 0x310E
+  WRITE_32            0x61A043C, 0x310F
+  WRITE_32            0x61A0440, 0x3110
+  WRITE_32            0x61A0444, 0x3111
+  WRITE_32            0x61A0448, 0x3112
+  WRITE_32            0x61A044C, 0x3113
+  WRITE_32            0x61A0450, 0x3114
+  WRITE_32            0x61A0454, 0x3115
+  WRITE_32            0x61A0458, 0x3116
+  WRITE_32            0x61A045C, 0x3117
+  WRITE_32            0x61A0460, 0x3118
+  WRITE_32            0x61A0464, 0x3119
+  WRITE_32            0x61A0468, 0x311A
+  WRITE_32            0x61A046C, 0x311B
+  WRITE_32            0x61A0470, 0x311C
+  WRITE_32            0x61A0474, 0x311D
+  WRITE_32            0x61A0478, 0x311E
+  WRITE_32            0x61A047C, 0x311F
+  WRITE_32            0x61A0480, 0x3120
+  WRITE_32            0x61A0484, 0x3121
+  WRITE_32            0x61A0488, 0x3122
+  WRITE_32            0x61A048C, 0x3123
+  WRITE_32            0x61A0490, 0x3124
+  WRITE_32            0x61A0494, 0x3125
+  WRITE_32            0x61A0498, 0x3126
+  WRITE_32            0x61A049C, 0x3127
+  WRITE_32            0x61A04A0, 0x3128
+  WRITE_32            0x61A04A4, 0x3129
+  WRITE_32            0x61A04A8, 0x312A
+  WRITE_32            0x61A04AC, 0x312B
+END_JOB
+
+START_JOB_DEFERRED 4
+  WRITE_32            0x81A0000, 0x4000
+  WRITE_32            0x81A0004, 0x4001
+  WRITE_32            0x81A0008, 0x4002
+  WRITE_32            0x81A000C, 0x4003
+  WRITE_32            0x81A0010, 0x4004
+  WRITE_32            0x81A0014, 0x4005
+  WRITE_32            0x81A0018, 0x4006
+  WRITE_32            0x81A001C, 0x4007
+  WRITE_32            0x81A0020, 0x4008
+  WRITE_32            0x81A0024, 0x4009
+  WRITE_32            0x81A0028, 0x400A
+  WRITE_32            0x81A002C, 0x400B
+  WRITE_32            0x81A0030, 0x400C
+  WRITE_32            0x81A0034, 0x400D
+  WRITE_32            0x81A0038, 0x400E
+  WRITE_32            0x81A003C, 0x400F
+  WRITE_32            0x81A0040, 0x4010
+  WRITE_32            0x81A0044, 0x4011
+  WRITE_32            0x81A0048, 0x4012
+  WRITE_32            0x81A004C, 0x4013
+  WRITE_32            0x81A0050, 0x4014
+  WRITE_32            0x81A0054, 0x4015
+  WRITE_32            0x81A0058, 0x4016
+  WRITE_32            0x81A005C, 0x4017
+  WRITE_32            0x81A0060, 0x4018
+  WRITE_32            0x81A0064, 0x4019
+  WRITE_32            0x81A0068, 0x401A
+  WRITE_32            0x81A006C, 0x401B
+  WRITE_32            0x81A0070, 0x401C
+  WRITE_32            0x81A0074, 0x401D
+  WRITE_32            0x81A0078, 0x401E
+  WRITE_32            0x81A007C, 0x401F
+  WRITE_32            0x81A0080, 0x4020
+  WRITE_32            0x81A0084, 0x4021
+  WRITE_32            0x81A0088, 0x4022
+  WRITE_32            0x81A008C, 0x4023
+  WRITE_32            0x81A0090, 0x4024
+  WRITE_32            0x81A0094, 0x4025
+  WRITE_32            0x81A0098, 0x4026
+  WRITE_32            0x81A009C, 0x4027
+  WRITE_32            0x81A00A0, 0x4028
+  WRITE_32            0x81A00A4, 0x4029
+  WRITE_32            0x81A00A8, 0x402A
+  WRITE_32            0x81A00AC, 0x402B
+  WRITE_32            0x81A00B0, 0x402C
+  WRITE_32            0x81A00B4, 0x402D
+  WRITE_32            0x81A00B8, 0x402E
+  WRITE_32            0x81A00BC, 0x402F
+  WRITE_32            0x81A00C0, 0x4030
+  WRITE_32            0x81A00C4, 0x4031
+  WRITE_32            0x81A00C8, 0x4032
+  WRITE_32            0x81A00CC, 0x4033
+  WRITE_32            0x81A00D0, 0x4034
+  WRITE_32            0x81A00D4, 0x4035
+  WRITE_32            0x81A00D8, 0x4036
+  WRITE_32            0x81A00DC, 0x4037
+  WRITE_32            0x81A00E0, 0x4038
+  WRITE_32            0x81A00E4, 0x4039
+  WRITE_32            0x81A00E8, 0x403A
+  WRITE_32            0x81A00EC, 0x403B
+  WRITE_32            0x81A00F0, 0x403C
+  WRITE_32            0x81A00F4, 0x403D
+  WRITE_32            0x81A00F8, 0x403E
+  WRITE_32            0x81A00FC, 0x403F
+  WRITE_32            0x81A0100, 0x4040
+  WRITE_32            0x81A0104, 0x4041
+  WRITE_32            0x81A0108, 0x4042
+  WRITE_32            0x81A010C, 0x4043
+  WRITE_32            0x81A0110, 0x4044
+  WRITE_32            0x81A0114, 0x4045
+  WRITE_32            0x81A0118, 0x4046
+  WRITE_32            0x81A011C, 0x4047
+  WRITE_32            0x81A0120, 0x4048
+  WRITE_32            0x81A0124, 0x4049
+  WRITE_32            0x81A0128, 0x404A
+  WRITE_32            0x81A012C, 0x404B
+  WRITE_32            0x81A0130, 0x404C
+  WRITE_32            0x81A0134, 0x404D
+  WRITE_32            0x81A0138, 0x404E
+  WRITE_32            0x81A013C, 0x404F
+  WRITE_32            0x81A0140, 0x4050
+  WRITE_32            0x81A0144, 0x4051
+  WRITE_32            0x81A0148, 0x4052
+  WRITE_32            0x81A014C, 0x4053
+  WRITE_32            0x81A0150, 0x4054
+  WRITE_32            0x81A0154, 0x4055
+  WRITE_32            0x81A0158, 0x4056
+  WRITE_32            0x81A015C, 0x4057
+  WRITE_32            0x81A0160, 0x4058
+  WRITE_32            0x81A0164, 0x4059
+  WRITE_32            0x81A0168, 0x405A
+  WRITE_32            0x81A016C, 0x405B
+  WRITE_32            0x81A0170, 0x405C
+  WRITE_32            0x81A0174, 0x405D
+  WRITE_32            0x81A0178, 0x405E
+  WRITE_32            0x81A017C, 0x405F
+  WRITE_32            0x81A0180, 0x4060
+  WRITE_32            0x81A0184, 0x4061
+  WRITE_32            0x81A0188, 0x4062
+  WRITE_32            0x81A018C, 0x4063
+  WRITE_32            0x81A0190, 0x4064
+  WRITE_32            0x81A0194, 0x4065
+  WRITE_32            0x81A0198, 0x4066
+  WRITE_32            0x81A019C, 0x4067
+  WRITE_32            0x81A01A0, 0x4068
+  WRITE_32            0x81A01A4, 0x4069
+  WRITE_32            0x81A01A8, 0x406A
+  WRITE_32            0x81A01AC, 0x406B
+  WRITE_32            0x81A01B0, 0x406C
+  WRITE_32            0x81A01B4, 0x406D
+  WRITE_32            0x81A01B8, 0x406E
+  WRITE_32            0x81A01BC, 0x406F
+  WRITE_32            0x81A01C0, 0x4070
+  WRITE_32            0x81A01C4, 0x4071
+  WRITE_32            0x81A01C8, 0x4072
+  WRITE_32            0x81A01CC, 0x4073
+  WRITE_32            0x81A01D0, 0x4074
+  WRITE_32            0x81A01D4, 0x4075
+  WRITE_32            0x81A01D8, 0x4076
+  WRITE_32            0x81A01DC, 0x4077
+  WRITE_32            0x81A01E0, 0x4078
+  WRITE_32            0x81A01E4, 0x4079
+  WRITE_32            0x81A01E8, 0x407A
+  WRITE_32            0x81A01EC, 0x407B
+  WRITE_32            0x81A01F0, 0x407C
+  WRITE_32            0x81A01F4, 0x407D
+  WRITE_32            0x81A01F8, 0x407E
+  WRITE_32            0x81A01FC, 0x407F
+  WRITE_32            0x81A0200, 0x4080
+  WRITE_32            0x81A0204, 0x4081
+  WRITE_32            0x81A0208, 0x4082
+  WRITE_32            0x81A020C, 0x4083
+  WRITE_32            0x81A0210, 0x4084
+  WRITE_32            0x81A0214, 0x4085
+  WRITE_32            0x81A0218, 0x4086
+  WRITE_32            0x81A021C, 0x4087
+  WRITE_32            0x81A0220, 0x4088
+  WRITE_32            0x81A0224, 0x4089
+  WRITE_32            0x81A0228, 0x408A
+  WRITE_32            0x81A022C, 0x408B
+  WRITE_32            0x81A0230, 0x408C
+  WRITE_32            0x81A0234, 0x408D
+  WRITE_32            0x81A0238, 0x408E
+  WRITE_32            0x81A023C, 0x408F
+  WRITE_32            0x81A0240, 0x4090
+  WRITE_32            0x81A0244, 0x4091
+  WRITE_32            0x81A0248, 0x4092
+  WRITE_32            0x81A024C, 0x4093
+  WRITE_32            0x81A0250, 0x4094
+  WRITE_32            0x81A0254, 0x4095
+  WRITE_32            0x81A0258, 0x4096
+  WRITE_32            0x81A025C, 0x4097
+  WRITE_32            0x81A0260, 0x4098
+  WRITE_32            0x81A0264, 0x4099
+  WRITE_32            0x81A0268, 0x409A
+  WRITE_32            0x81A026C, 0x409B
+  WRITE_32            0x81A0270, 0x409C
+  WRITE_32            0x81A0274, 0x409D
+  WRITE_32            0x81A0278, 0x409E
+  WRITE_32            0x81A027C, 0x409F
+  WRITE_32            0x81A0280, 0x40A0
+  WRITE_32            0x81A0284, 0x40A1
+  WRITE_32            0x81A0288, 0x40A2
+  WRITE_32            0x81A028C, 0x40A3
+  WRITE_32            0x81A0290, 0x40A4
+  WRITE_32            0x81A0294, 0x40A5
+  WRITE_32            0x81A0298, 0x40A6
+  WRITE_32            0x81A029C, 0x40A7
+  WRITE_32            0x81A02A0, 0x40A8
+  WRITE_32            0x81A02A4, 0x40A9
+  WRITE_32            0x81A02A8, 0x40AA
+  WRITE_32            0x81A02AC, 0x40AB
+  WRITE_32            0x81A02B0, 0x40AC
+  WRITE_32            0x81A02B4, 0x40AD
+  WRITE_32            0x81A02B8, 0x40AE
+  WRITE_32            0x81A02BC, 0x40AF
+  WRITE_32            0x81A02C0, 0x40B0
+  WRITE_32            0x81A02C4, 0x40B1
+  WRITE_32            0x81A02C8, 0x40B2
+  WRITE_32            0x81A02CC, 0x40B3
+  WRITE_32            0x81A02D0, 0x40B4
+  WRITE_32            0x81A02D4, 0x40B5
+  WRITE_32            0x81A02D8, 0x40B6
+  WRITE_32            0x81A02DC, 0x40B7
+  WRITE_32            0x81A02E0, 0x40B8
+  WRITE_32            0x81A02E4, 0x40B9
+  WRITE_32            0x81A02E8, 0x40BA
+  WRITE_32            0x81A02EC, 0x40BB
+  WRITE_32            0x81A02F0, 0x40BC
+  WRITE_32            0x81A02F4, 0x40BD
+  WRITE_32            0x81A02F8, 0x40BE
+  WRITE_32            0x81A02FC, 0x40BF
+  WRITE_32            0x81A0300, 0x40C0
+  WRITE_32            0x81A0304, 0x40C1
+  WRITE_32            0x81A0308, 0x40C2
+  WRITE_32            0x81A030C, 0x40C3
+  WRITE_32            0x81A0310, 0x40C4
+  WRITE_32            0x81A0314, 0x40C5
+  WRITE_32            0x81A0318, 0x40C6
+  WRITE_32            0x81A031C, 0x40C7
+END_JOB
+
+START_JOB_DEFERRED 5
+  WRITE_32            0xA1A0000, 0x5000
+  WRITE_32            0xA1A0004, 0x5001
+  WRITE_32            0xA1A0008, 0x5002
+  WRITE_32            0xA1A000C, 0x5003
+  WRITE_32            0xA1A0010, 0x5004
+  WRITE_32            0xA1A0014, 0x5005
+  WRITE_32            0xA1A0018, 0x5006
+  WRITE_32            0xA1A001C, 0x5007
+  WRITE_32            0xA1A0020, 0x5008
+  WRITE_32            0xA1A0024, 0x5009
+  WRITE_32            0xA1A0028, 0x500A
+  WRITE_32            0xA1A002C, 0x500B
+  WRITE_32            0xA1A0030, 0x500C
+  WRITE_32            0xA1A0034, 0x500D
+  WRITE_32            0xA1A0038, 0x500E
+  WRITE_32            0xA1A003C, 0x500F
+  WRITE_32            0xA1A0040, 0x5010
+  WRITE_32            0xA1A0044, 0x5011
+  WRITE_32            0xA1A0048, 0x5012
+  WRITE_32            0xA1A004C, 0x5013
+  WRITE_32            0xA1A0050, 0x5014
+  WRITE_32            0xA1A0054, 0x5015
+  WRITE_32            0xA1A0058, 0x5016
+  WRITE_32            0xA1A005C, 0x5017
+  WRITE_32            0xA1A0060, 0x5018
+  WRITE_32            0xA1A0064, 0x5019
+  WRITE_32            0xA1A0068, 0x501A
+  WRITE_32            0xA1A006C, 0x501B
+  WRITE_32            0xA1A0070, 0x501C
+  WRITE_32            0xA1A0074, 0x501D
+  WRITE_32            0xA1A0078, 0x501E
+  WRITE_32            0xA1A007C, 0x501F
+  WRITE_32            0xA1A0080, 0x5020
+  WRITE_32            0xA1A0084, 0x5021
+  WRITE_32            0xA1A0088, 0x5022
+  WRITE_32            0xA1A008C, 0x5023
+  WRITE_32            0xA1A0090, 0x5024
+  WRITE_32            0xA1A0094, 0x5025
+  WRITE_32            0xA1A0098, 0x5026
+  WRITE_32            0xA1A009C, 0x5027
+  WRITE_32            0xA1A00A0, 0x5028
+  WRITE_32            0xA1A00A4, 0x5029
+  WRITE_32            0xA1A00A8, 0x502A
+  WRITE_32            0xA1A00AC, 0x502B
+  WRITE_32            0xA1A00B0, 0x502C
+  WRITE_32            0xA1A00B4, 0x502D
+  WRITE_32            0xA1A00B8, 0x502E
+  WRITE_32            0xA1A00BC, 0x502F
+  WRITE_32            0xA1A00C0, 0x5030
+  WRITE_32            0xA1A00C4, 0x5031
+  WRITE_32            0xA1A00C8, 0x5032
+  WRITE_32            0xA1A00CC, 0x5033
+  WRITE_32            0xA1A00D0, 0x5034
+  WRITE_32            0xA1A00D4, 0x5035
+  WRITE_32            0xA1A00D8, 0x5036
+  WRITE_32            0xA1A00DC, 0x5037
+  WRITE_32            0xA1A00E0, 0x5038
+  WRITE_32            0xA1A00E4, 0x5039
+  WRITE_32            0xA1A00E8, 0x503A
+  WRITE_32            0xA1A00EC, 0x503B
+  WRITE_32            0xA1A00F0, 0x503C
+  WRITE_32            0xA1A00F4, 0x503D
+  WRITE_32            0xA1A00F8, 0x503E
+  WRITE_32            0xA1A00FC, 0x503F
+  WRITE_32            0xA1A0100, 0x5040
+  WRITE_32            0xA1A0104, 0x5041
+  WRITE_32            0xA1A0108, 0x5042
+  WRITE_32            0xA1A010C, 0x5043
+  WRITE_32            0xA1A0110, 0x5044
+  WRITE_32            0xA1A0114, 0x5045
+  WRITE_32            0xA1A0118, 0x5046
+  WRITE_32            0xA1A011C, 0x5047
+  WRITE_32            0xA1A0120, 0x5048
+  WRITE_32            0xA1A0124, 0x5049
+  WRITE_32            0xA1A0128, 0x504A
+  WRITE_32            0xA1A012C, 0x504B
+  WRITE_32            0xA1A0130, 0x504C
+  WRITE_32            0xA1A0134, 0x504D
+  WRITE_32            0xA1A0138, 0x504E
+  WRITE_32            0xA1A013C, 0x504F
+  WRITE_32            0xA1A0140, 0x5050
+  WRITE_32            0xA1A0144, 0x5051
+  WRITE_32            0xA1A0148, 0x5052
+  WRITE_32            0xA1A014C, 0x5053
+  WRITE_32            0xA1A0150, 0x5054
+  WRITE_32            0xA1A0154, 0x5055
+  WRITE_32            0xA1A0158, 0x5056
+  WRITE_32            0xA1A015C, 0x5057
+  WRITE_32            0xA1A0160, 0x5058
+  WRITE_32            0xA1A0164, 0x5059
+  WRITE_32            0xA1A0168, 0x505A
+  WRITE_32            0xA1A016C, 0x505B
+  WRITE_32            0xA1A0170, 0x505C
+  WRITE_32            0xA1A0174, 0x505D
+  WRITE_32            0xA1A0178, 0x505E
+  WRITE_32            0xA1A017C, 0x505F
+  WRITE_32            0xA1A0180, 0x5060
+  WRITE_32            0xA1A0184, 0x5061
+  WRITE_32            0xA1A0188, 0x5062
+  WRITE_32            0xA1A018C, 0x5063
+  WRITE_32            0xA1A0190, 0x5064
+  WRITE_32            0xA1A0194, 0x5065
+  WRITE_32            0xA1A0198, 0x5066
+  WRITE_32            0xA1A019C, 0x5067
+  WRITE_32            0xA1A01A0, 0x5068
+  WRITE_32            0xA1A01A4, 0x5069
+  WRITE_32            0xA1A01A8, 0x506A
+  WRITE_32            0xA1A01AC, 0x506B
+  WRITE_32            0xA1A01B0, 0x506C
+  WRITE_32            0xA1A01B4, 0x506D
+  WRITE_32            0xA1A01B8, 0x506E
+  WRITE_32            0xA1A01BC, 0x506F
+  WRITE_32            0xA1A01C0, 0x5070
+  WRITE_32            0xA1A01C4, 0x5071
+  WRITE_32            0xA1A01C8, 0x5072
+  WRITE_32            0xA1A01CC, 0x5073
+  WRITE_32            0xA1A01D0, 0x5074
+  WRITE_32            0xA1A01D4, 0x5075
+  WRITE_32            0xA1A01D8, 0x5076
+  WRITE_32            0xA1A01DC, 0x5077
+  WRITE_32            0xA1A01E0, 0x5078
+  WRITE_32            0xA1A01E4, 0x5079
+  WRITE_32            0xA1A01E8, 0x507A
+  WRITE_32            0xA1A01EC, 0x507B
+  WRITE_32            0xA1A01F0, 0x507C
+  WRITE_32            0xA1A01F4, 0x507D
+  WRITE_32            0xA1A01F8, 0x507E
+  WRITE_32            0xA1A01FC, 0x507F
+  WRITE_32            0xA1A0200, 0x5080
+  WRITE_32            0xA1A0204, 0x5081
+  WRITE_32            0xA1A0208, 0x5082
+  WRITE_32            0xA1A020C, 0x5083
+  WRITE_32            0xA1A0210, 0x5084
+  WRITE_32            0xA1A0214, 0x5085
+  WRITE_32            0xA1A0218, 0x5086
+  WRITE_32            0xA1A021C, 0x5087
+  WRITE_32            0xA1A0220, 0x5088
+  WRITE_32            0xA1A0224, 0x5089
+  WRITE_32            0xA1A0228, 0x508A
+  WRITE_32            0xA1A022C, 0x508B
+  WRITE_32            0xA1A0230, 0x508C
+  WRITE_32            0xA1A0234, 0x508D
+  WRITE_32            0xA1A0238, 0x508E
+  WRITE_32            0xA1A023C, 0x508F
+  WRITE_32            0xA1A0240, 0x5090
+  WRITE_32            0xA1A0244, 0x5091
+  WRITE_32            0xA1A0248, 0x5092
+  WRITE_32            0xA1A024C, 0x5093
+  WRITE_32            0xA1A0250, 0x5094
+  WRITE_32            0xA1A0254, 0x5095
+  WRITE_32            0xA1A0258, 0x5096
+  WRITE_32            0xA1A025C, 0x5097
+  WRITE_32            0xA1A0260, 0x5098
+  WRITE_32            0xA1A0264, 0x5099
+  WRITE_32            0xA1A0268, 0x509A
+  WRITE_32            0xA1A026C, 0x509B
+  WRITE_32            0xA1A0270, 0x509C
+  WRITE_32            0xA1A0274, 0x509D
+  WRITE_32            0xA1A0278, 0x509E
+  WRITE_32            0xA1A027C, 0x509F
+  WRITE_32            0xA1A0280, 0x50A0
+  WRITE_32            0xA1A0284, 0x50A1
+  WRITE_32            0xA1A0288, 0x50A2
+  WRITE_32            0xA1A028C, 0x50A3
+  WRITE_32            0xA1A0290, 0x50A4
+  WRITE_32            0xA1A0294, 0x50A5
+  WRITE_32            0xA1A0298, 0x50A6
+  WRITE_32            0xA1A029C, 0x50A7
+  WRITE_32            0xA1A02A0, 0x50A8
+  WRITE_32            0xA1A02A4, 0x50A9
+  WRITE_32            0xA1A02A8, 0x50AA
+  WRITE_32            0xA1A02AC, 0x50AB
+  WRITE_32            0xA1A02B0, 0x50AC
+  WRITE_32            0xA1A02B4, 0x50AD
+  WRITE_32            0xA1A02B8, 0x50AE
+  WRITE_32            0xA1A02BC, 0x50AF
+  WRITE_32            0xA1A02C0, 0x50B0
+  WRITE_32            0xA1A02C4, 0x50B1
+  WRITE_32            0xA1A02C8, 0x50B2
+  WRITE_32            0xA1A02CC, 0x50B3
+  WRITE_32            0xA1A02D0, 0x50B4
+  WRITE_32            0xA1A02D4, 0x50B5
+  WRITE_32            0xA1A02D8, 0x50B6
+  WRITE_32            0xA1A02DC, 0x50B7
+  WRITE_32            0xA1A02E0, 0x50B8
+  WRITE_32            0xA1A02E4, 0x50B9
+  WRITE_32            0xA1A02E8, 0x50BA
+  WRITE_32            0xA1A02EC, 0x50BB
+  WRITE_32            0xA1A02F0, 0x50BC
+  WRITE_32            0xA1A02F4, 0x50BD
+  WRITE_32            0xA1A02F8, 0x50BE
+  WRITE_32            0xA1A02FC, 0x50BF
+  WRITE_32            0xA1A0300, 0x50C0
+  WRITE_32            0xA1A0304, 0x50C1
+  WRITE_32            0xA1A0308, 0x50C2
+  WRITE_32            0xA1A030C, 0x50C3
+  WRITE_32            0xA1A0310, 0x50C4
+  WRITE_32            0xA1A0314, 0x50C5
+  WRITE_32            0xA1A0318, 0x50C6
+  WRITE_32            0xA1A031C, 0x50C7
+END_JOB
+
+EOF
@@ -0,0 +1,1161 @@
+;
+; Four independent jobs of 370, 370, 200 and 200 WRITE_32 (about 55% and
+; 30% of a page). In source order the large jobs don't share a page and the
+; second one leaves room for only one small job, greedy packing needs three
+; pages. First fit decreasing pairs each large job with a small one in two
+; pages.
+;
+.attach_to_group 0
+START_JOB 0
+  WRITE_32            0x1A0000, 0x0
+  WRITE_32            0x1A0004, 0x1
+  WRITE_32            0x1A0008, 0x2
+  WRITE_32            0x1A000C, 0x3
+  WRITE_32            0x1A0010, 0x4
+  WRITE_32            0x1A0014, 0x5
+  WRITE_32            0x1A0018, 0x6
+  WRITE_32            0x1A001C, 0x7
+  WRITE_32            0x1A0020, 0x8
+  WRITE_32            0x1A0024, 0x9
+  WRITE_32            0x1A0028, 0xA
+  WRITE_32            0x1A002C, 0xB
+  WRITE_32            0x1A0030, 0xC
+  WRITE_32            0x1A0034, 0xD
+  WRITE_32            0x1A0038, 0xE
+  WRITE_32            0x1A003C, 0xF
+  WRITE_32            0x1A0040, 0x10
+  WRITE_32            0x1A0044, 0x11
+  WRITE_32            0x1A0048, 0x12
+  WRITE_32            0x1A004C, 0x13
+  WRITE_32            0x1A0050, 0x14
+  WRITE_32            0x1A0054, 0x15
+  WRITE_32            0x1A0058, 0x16
+  WRITE_32            0x1A005C, 0x17
+  WRITE_32            0x1A0060, 0x18
+  WRITE_32            0x1A0064, 0x19
+  WRITE_32            0x1A0068, 0x1A
+  WRITE_32            0x1A006C, 0x1B
+  WRITE_32            0x1A0070, 0x1C
+  WRITE_32            0x1A0074, 0x1D
+  WRITE_32            0x1A0078, 0x1E
+  WRITE_32            0x1A007C, 0x1F
+  WRITE_32            0x1A0080, 0x20
+  WRITE_32            0x1A0084, 0x21
+  WRITE_32            0x1A0088, 0x22
+  WRITE_32            0x1A008C, 0x23
+  WRITE_32            0x1A0090, 0x24
+  WRITE_32            0x1A0094, 0x25
+  WRITE_32            0x1A0098, 0x26
+  WRITE_32            0x1A009C, 0x27
+  WRITE_32            0x1A00A0, 0x28
+  WRITE_32            0x1A00A4, 0x29
+  WRITE_32            0x1A00A8, 0x2A
+  WRITE_32            0x1A00AC, 0x2B
+  WRITE_32            0x1A00B0, 0x2C
+  WRITE_32            0x1A00B4, 0x2D
+  WRITE_32            0x1A00B8, 0x2E
+  WRITE_32            0x1A00BC, 0x2F
+  WRITE_32            0x1A00C0, 0x30
+  WRITE_32            0x1A00C4, 0x31
+  WRITE_32            0x1A00C8, 0x32
+  WRITE_32            0x1A00CC, 0x33
+  WRITE_32            0x1A00D0, 0x34
+  WRITE_32            0x1A00D4, 0x35
+  WRITE_32            0x1A00D8, 0x36
+  WRITE_32            0x1A00DC, 0x37
+  WRITE_32            0x1A00E0, 0x38
+  WRITE_32            0x1A00E4, 0x39
+  WRITE_32            0x1A00E8, 0x3A
+  WRITE_32            0x1A00EC, 0x3B
+  WRITE_32            0x1A00F0, 0x3C
+  WRITE_32            0x1A00F4, 0x3D
+  WRITE_32            0x1A00F8, 0x3E
+  WRITE_32            0x1A00FC, 0x3F
+  WRITE_32            0x1A0100, 0x40
+  WRITE_32            0x1A0104, 0x41
+  WRITE_32            0x1A0108, 0x42
+  WRITE_32            0x1A010C, 0x43
+  WRITE_32            0x1A0110, 0x44
+  WRITE_32            0x1A0114, 0x45
+  WRITE_32            0x1A0118, 0x46
+  WRITE_32            0x1A011C, 0x47
+  WRITE_32            0x1A0120, 0x48
+  WRITE_32            0x1A0124, 0x49
+  WRITE_32            0x1A0128, 0x4A
+  WRITE_32            0x1A012C, 0x4B
+  WRITE_32            0x1A0130, 0x4C
+  WRITE_32            0x1A0134, 0x4D
+  WRITE_32            0x1A0138, 0x4E
+  WRITE_32            0x1A013C, 0x4F
+  WRITE_32            0x1A0140, 0x50
+  WRITE_32            0x1A0144, 0x51
+  WRITE_32            0x1A0148, 0x52
+  WRITE_32            0x1A014C, 0x53
+  WRITE_32            0x1A0150, 0x54
+  WRITE_32            0x1A0154, 0x55
+  WRITE_32            0x1A0158, 0x56
+  WRITE_32            0x1A015C, 0x57
+  WRITE_32            0x1A0160, 0x58
+  WRITE_32            0x1A0164, 0x59
+  WRITE_32            0x1A0168, 0x5A
+  WRITE_32            0x1A016C, 0x5B
+  WRITE_32            0x1A0170, 0x5C
+  WRITE_32            0x1A0174, 0x5D
+  WRITE_32            0x1A0178, 0x5E
+  WRITE_32            0x1A017C, 0x5F
+  WRITE_32            0x1A0180, 0x60
+  WRITE_32            0x1A0184, 0x61
+  WRITE_32            0x1A0188, 0x62
+  WRITE_32            0x1A018C, 0x63
+  WRITE_32            0x1A0190, 0x64
+  WRITE_32            0x1A0194, 0x65
+  WRITE_32            0x1A0198, 0x66
+  WRITE_32            0x1A019C, 0x67
+  WRITE_32            0x1A01A0, 0x68
+  WRITE_32            0x1A01A4, 0x69
+  WRITE_32            0x1A01A8, 0x6A
+  WRITE_32            0x1A01AC, 0x6B
+  WRITE_32            0x1A01B0, 0x6C
+  WRITE_32            0x1A01B4, 0x6D
+  WRITE_32            0x1A01B8, 0x6E
+  WRITE_32            0x1A01BC, 0x6F
+  WRITE_32            0x1A01C0, 0x70
+  WRITE_32            0x1A01C4, 0x71
+  WRITE_32            0x1A01C8, 0x72
+  WRITE_32            0x1A01CC, 0x73
+  WRITE_32            0x1A01D0, 0x74
+  WRITE_32            0x1A01D4, 0x75
+  WRITE_32            0x1A01D8, 0x76
+  WRITE_32            0x1A01DC, 0x77
+  WRITE_32            0x1A01E0, 0x78
+  WRITE_32            0x1A01E4, 0x79
+  WRITE_32            0x1A01E8, 0x7A
+  WRITE_32            0x1A01EC, 0x7B
+  WRITE_32            0x1A01F0, 0x7C
+  WRITE_32            0x1A01F4, 0x7D
+  WRITE_32            0x1A01F8, 0x7E
+  WRITE_32            0x1A01FC, 0x7F
+  WRITE_32            0x1A0200, 0x80
+  WRITE_32            0x1A0204, 0x81
+  WRITE_32            0x1A0208, 0x82
+  WRITE_32            0x1A020C, 0x83
+  WRITE_32            0x1A0210, 0x84
+  WRITE_32            0x1A0214, 0x85
+  WRITE_32            0x1A0218, 0x86
+  WRITE_32            0x1A021C, 0x87
+  WRITE_32            0x1A0220, 0x88
+  WRITE_32            0x1A0224, 0x89
+  WRITE_32            0x1A0228, 0x8A
+  WRITE_32            0x1A022C, 0x8B
+  WRITE_32            0x1A0230, 0x8C
+  WRITE_32            0x1A0234, 0x8D
+  WRITE_32            0x1A0238, 0x8E
+  WRITE_32            0x1A023C, 0x8F
+  WRITE_32            0x1A0240, 0x90
+  WRITE_32            0x1A0244, 0x91
+  WRITE_32            0x1A0248, 0x92
+  WRITE_32            0x1A024C, 0x93
+  WRITE_32            0x1A0250, 0x94
+  WRITE_32            0x1A0254, 0x95
+  WRITE_32            0x1A0258, 0x96
+  WRITE_32            0x1A025C, 0x97
+  WRITE_32            0x1A0260, 0x98
+  WRITE_32            0x1A0264, 0x99
+  WRITE_32            0x1A0268, 0x9A
+  WRITE_32            0x1A026C, 0x9B
+  WRITE_32            0x1A0270, 0x9C
+  WRITE_32            0x1A0274, 0x9D
+  WRITE_32            0x1A0278, 0x9E
+  WRITE_32            0x1A027C, 0x9F
+  WRITE_32            0x1A0280, 0xA0
+  WRITE_32            0x1A0284, 0xA1
+  WRITE_32            0x1A0288, 0xA2
+  WRITE_32            0x1A028C, 0xA3
+  WRITE_32            0x1A0290, 0xA4
+  WRITE_32            0x1A0294, 0xA5
+  WRITE_32            0x1A0298, 0xA6
+  WRITE_32            0x1A029C, 0xA7
+  WRITE_32            0x1A02A0, 0xA8
+  WRITE_32            0x1A02A4, 0xA9
+  WRITE_32            0x1A02A8, 0xAA
+  WRITE_32            0x1A02AC, 0xAB
+  WRITE_32            0x1A02B0, 0xAC
+  WRITE_32            0x1A02B4, 0xAD
+  WRITE_32            0x1A02B8, 0xAE
+  WRITE_32            0x1A02BC, 0xAF
+  WRITE_32            0x1A02C0, 0xB0
+  WRITE_32            0x1A02C4, 0xB1
+  WRITE_32            0x1A02C8, 0xB2
+  WRITE_32            0x1A02CC, 0xB3
+  WRITE_32            0x1A02D0, 0xB4
+  WRITE_32            0x1A02D4, 0xB5
+  WRITE_32            0x1A02D8, 0xB6
+  WRITE_32            0x1A02DC, 0xB7
+  WRITE_32            0x1A02E0, 0xB8
+  WRITE_32            0x1A02E4, 0xB9
+  WRITE_32            0x1A02E8, 0xBA
+  WRITE_32            0x1A02EC, 0xBB
+  WRITE_32            0x1A02F0, 0xBC
+  WRITE_32            0x1A02F4, 0xBD
+  WRITE_32            0x1A02F8, 0xBE
+  WRITE_32            0x1A02FC, 0xBF
+  WRITE_32            0x1A0300, 0xC0
+  WRITE_32            0x1A0304, 0xC1
+  WRITE_32            0x1A0308, 0xC2
+  WRITE_32            0x1A030C, 0xC3
+  WRITE_32            0x1A0310, 0xC4
+  WRITE_32            0x1A0314, 0xC5
+  WRITE_32            0x1A0318, 0xC6
+  WRITE_32            0x1A031C, 0xC7
+  WRITE_32            0x1A0320, 0xC8
+  WRITE_32            0x1A0324, 0xC9
+  WRITE_32            0x1A0328, 0xCA
+  WRITE_32            0x1A032C, 0xCB
+  WRITE_32            0x1A0330, 0xCC
+  WRITE_32            0x1A0334, 0xCD
+  WRITE_32            0x1A0338, 0xCE
+  WRITE_32            0x1A033C, 0xCF
+  WRITE_32            0x1A0340, 0xD0
+  WRITE_32            0x1A0344, 0xD1
+  WRITE_32            0x1A0348, 0xD2
+  WRITE_32            0x1A034C, 0xD3
+  WRITE_32            0x1A0350, 0xD4
+  WRITE_32            0x1A0354, 0xD5
+  WRITE_32            0x1A0358, 0xD6
+  WRITE_32            0x1A035C, 0xD7
+  WRITE_32            0x1A0360, 0xD8
+  WRITE_32            0x1A0364, 0xD9
+  WRITE_32            0x1A0368, 0xDA
+  WRITE_32            0x1A036C, 0xDB
+  WRITE_32            0x1A0370, 0xDC
+  WRITE_32            0x1A0374, 0xDD
+  WRITE_32            0x1A0378, 0xDE
+  WRITE_32            0x1A037C, 0xDF
+  WRITE_32            0x1A0380, 0xE0
+  WRITE_32            0x1A0384, 0xE1
+  WRITE_32            0x1A0388, 0xE2
+  WRITE_32            0x1A038C, 0xE3
+  WRITE_32            0x1A0390, 0xE4
+  WRITE_32            0x1A0394, 0xE5
+  WRITE_32            0x1A0398, 0xE6
+  WRITE_32            0x1A039C, 0xE7
+  WRITE_32            0x1A03A0, 0xE8
+  WRITE_32            0x1A03A4, 0xE9
+  WRITE_32            0x1A03A8, 0xEA
+  WRITE_32            0x1A03AC, 0xEB
+  WRITE_32            0x1A03B0, 0xEC
+  WRITE_32            0x1A03B4, 0xED
+  WRITE_32            0x1A03B8, 0xEE
+  WRITE_32            0x1A03BC, 0xEF
+  WRITE_32            0x1A03C0, 0xF0
+  WRITE_32            0x1A03C4, 0xF1
+  WRITE_32            0x1A03C8, 0xF2
+  WRITE_32            0x1A03CC, 0xF3
+  WRITE_32            0x1A03D0, 0xF4
+  WRITE_32            0x1A03D4, 0xF5
+  WRITE_32            0x1A03D8, 0xF6
+  WRITE_32            0x1A03DC, 0xF7
+  WRITE_32            0x1A03E0, 0xF8
+  WRITE_32            0x1A03E4, 0xF9
+  WRITE_32            0x1A03E8, 0xFA
+  WRITE_32            0x1A03EC, 0xFB
+  WRITE_32            0x1A03F0, 0xFC
+  WRITE_32            0x1A03F4, 0xFD
+  WRITE_32            0x1A03F8, 0xFE
+  WRITE_32            0x1A03FC, 0xFF
+  WRITE_32            0x1A0400, 0x100
+  WRITE_32            0x1A0404, 0x101
+  WRITE_32            0x1A0408, 0x102
+  WRITE_32            0x1A040C, 0x103
+  WRITE_32            0x1A0410, 0x104
+  WRITE_32            0x1A0414, 0x105
+  WRITE_32            0x1A0418, 0x106
+  WRITE_32            0x1A041C, 0x107
+  WRITE_32            0x1A0420, 0x108
+  WRITE_32            0x1A0424, 0x109
+  WRITE_32            0x1A0428, 0x10A
+  WRITE_32            0x1A042C, 0x10B
+  WRITE_32            0x1A0430, 0x10C
+  WRITE_32            0x1A0434, 0x10D
+  WRITE_32            0x1A0438, 0x10E
+  WRITE_32            0x1A043C, 0x10F
+  WRITE_32            0x1A0440, 0x110
+  WRITE_32            0x1A0444, 0x111
+  WRITE_32            0x1A0448, 0x112
+  WRITE_32            0x1A044C, 0x113
+  WRITE_32            0x1A0450, 0x114
+  WRITE_32            0x1A0454, 0x115
+  WRITE_32            0x1A0458, 0x116
+  WRITE_32            0x1A045C, 0x117
+  WRITE_32            0x1A0460, 0x118
+  WRITE_32            0x1A0464, 0x119
+  WRITE_32            0x1A0468, 0x11A
+  WRITE_32            0x1A046C, 0x11B
+  WRITE_32            0x1A0470, 0x11C
+  WRITE_32            0x1A0474, 0x11D
+  WRITE_32            0x1A0478, 0x11E
+  WRITE_32            0x1A047C, 0x11F
+  WRITE_32            0x1A0480, 0x120
+  WRITE_32            0x1A0484, 0x121
+  WRITE_32            0x1A0488, 0x122
+  WRITE_32            0x1A048C, 0x123
+  WRITE_32            0x1A0490, 0x124
+  WRITE_32            0x1A0494, 0x125
+  WRITE_32            0x1A0498, 0x126
+  WRITE_32            0x1A049C, 0x127
+  WRITE_32            0x1A04A0, 0x128
+  WRITE_32            0x1A04A4, 0x129
+  WRITE_32            0x1A04A8, 0x12A
+  WRITE_32            0x1A04AC, 0x12B
+  WRITE_32            0x1A04B0, 0x12C
+  WRITE_32            0x1A04B4, 0x12D
+  WRITE_32            0x1A04B8, 0x12E
+  WRITE_32            0x1A04BC, 0x12F
+  WRITE_32            0x1A04C0, 0x130
+  WRITE_32            0x1A04C4, 0x131
+  WRITE_32            0x1A04C8, 0x132
+  WRITE_32            0x1A04CC, 0x133
+  WRITE_32            0x1A04D0, 0x134
+  WRITE_32            0x1A04D4, 0x135
+  WRITE_32            0x1A04D8, 0x136
+  WRITE_32            0x1A04DC, 0x137
+  WRITE_32            0x1A04E0, 0x138
+  WRITE_32            0x1A04E4, 0x139
+  WRITE_32            0x1A04E8, 0x13A
+  WRITE_32            0x1A04EC, 0x13B
+  WRITE_32            0x1A04F0, 0x13C
+  WRITE_32            0x1A04F4, 0x13D
+  WRITE_32            0x1A04F8, 0x13E
+  WRITE_32            0x1A04FC, 0x13F
+  WRITE_32            0x1A0500, 0x140
+  WRITE_32            0x1A0504, 0x141
+  WRITE_32            0x1A0508, 0x142
+  WRITE_32            0x1A050C, 0x143
+  WRITE_32            0x1A0510, 0x144
+  WRITE_32            0x1A0514, 0x145
+  WRITE_32            0x1A0518, 0x146
+  WRITE_32            0x1A051C, 0x147
+  WRITE_32            0x1A0520, 0x148
+  WRITE_32            0x1A0524, 0x149
+  WRITE_32            0x1A0528, 0x14A
+  WRITE_32            0x1A052C, 0x14B
+  WRITE_32            0x1A0530, 0x14C
+  WRITE_32            0x1A0534, 0x14D
+  WRITE_32            0x1A0538, 0x14E
+  WRITE_32            0x1A053C, 0x14F
+  WRITE_32            0x1A0540, 0x150
+  WRITE_32            0x1A0544, 0x151
+  WRITE_32            0x1A0548, 0x152
+  WRITE_32            0x1A054C, 0x153
+  WRITE_32            0x1A0550, 0x154
+  WRITE_32            0x1A0554, 0x155
+  WRITE_32            0x1A0558, 0x156
+  WRITE_32            0x1A055C, 0x157
+  WRITE_32            0x1A0560, 0x158
+  WRITE_32            0x1A0564, 0x159
+  WRITE_32            0x1A0568, 0x15A
+  WRITE_32            0x1A056C, 0x15B
+  WRITE_32            0x1A0570, 0x15C
+  WRITE_32            0x1A0574, 0x15D
+  WRITE_32            0x1A0578, 0x15E
+  WRITE_32            0x1A057C, 0x15F
+  WRITE_32            0x1A0580, 0x160
+  WRITE_32            0x1A0584, 0x161
+  WRITE_32            0x1A0588, 0x162
+  WRITE_32            0x1A058C, 0x163
+  WRITE_32            0x1A0590, 0x164
+  WRITE_32            0x1A0594, 0x165
+  WRITE_32            0x1A0598, 0x166
+  WRITE_32            0x1A059C, 0x167
+  WRITE_32            0x1A05A0, 0x168
+  WRITE_32            0x1A05A4, 0x169
+  WRITE_32            0x1A05A8, 0x16A
+  WRITE_32            0x1A05AC, 0x16B
+  WRITE_32            0x1A05B0, 0x16C
+  WRITE_32            0x1A05B4, 0x16D
+  WRITE_32            0x1A05B8, 0x16E
+  WRITE_32            0x1A05BC, 0x16F
+  WRITE_32            0x1A05C0, 0x170
+  WRITE_32            0x1A05C4, 0x171
+END_JOB
+
+START_JOB 1
+  WRITE_32            0x21A0000, 0x1000
+  WRITE_32            0x21A0004, 0x1001
+  WRITE_32            0x21A0008, 0x1002
+  WRITE_32            0x21A000C, 0x1003
+  WRITE_32            0x21A0010, 0x1004
+  WRITE_32            0x21A0014, 0x1005
+  WRITE_32            0x21A0018, 0x1006
+  WRITE_32            0x21A001C, 0x1007
+  WRITE_32            0x21A0020, 0x1008
+  WRITE_32            0x21A0024, 0x1009
+  WRITE_32            0x21A0028, 0x100A
+  WRITE_32            0x21A002C, 0x100B
+  WRITE_32            0x21A0030, 0x100C
+  WRITE_32            0x21A0034, 0x100D
+  WRITE_32            0x21A0038, 0x100E
+  WRITE_32            0x21A003C, 0x100F
+  WRITE_32            0x21A0040, 0x1010
+  WRITE_32            0x21A0044, 0x1011
+  WRITE_32            0x21A0048, 0x1012
+  WRITE_32            0x21A004C, 0x1013
+  WRITE_32            0x21A0050, 0x1014
+  WRITE_32            0x21A0054, 0x1015
+  WRITE_32            0x21A0058, 0x1016
+  WRITE_32            0x21A005C, 0x1017
+  WRITE_32            0x21A0060, 0x1018
+  WRITE_32            0x21A0064, 0x1019
+  WRITE_32            0x21A0068, 0x101A
+  WRITE_32            0x21A006C, 0x101B
+  WRITE_32            0x21A0070, 0x101C
+  WRITE_32            0x21A0074, 0x101D
+  WRITE_32            0x21A0078, 0x101E
+  WRITE_32            0x21A007C, 0x101F
+  WRITE_32            0x21A0080, 0x1020
+  WRITE_32            0x21A0084, 0x1021
+  WRITE_32            0x21A0088, 0x1022
+  WRITE_32            0x21A008C, 0x1023
+  WRITE_32            0x21A0090, 0x1024
+  WRITE_32            0x21A0094, 0x1025
+  WRITE_32            0x21A0098, 0x1026
+  WRITE_32            0x21A009C, 0x1027
+  WRITE_32            0x21A00A0, 0x1028
+  WRITE_32            0x21A00A4, 0x1029
+  WRITE_32            0x21A00A8, 0x102A
+  WRITE_32            0x21A00AC, 0x102B
+  WRITE_32            0x21A00B0, 0x102C
+  WRITE_32            0x21A00B4, 0x102D
+  WRITE_32            0x21A00B8, 0x102E
+  WRITE_32            0x21A00BC, 0x102F
+  WRITE_32            0x21A00C0, 0x1030
+  WRITE_32            0x21A00C4, 0x1031
+  WRITE_32            0x21A00C8, 0x1032
+  WRITE_32            0x21A00CC, 0x1033
+  WRITE_32            0x21A00D0, 0x1034
+  WRITE_32            0x21A00D4, 0x1035
+  WRITE_32            0x21A00D8, 0x1036
+  WRITE_32            0x21A00DC, 0x1037
+  WRITE_32            0x21A00E0, 0x1038
+  WRITE_32            0x21A00E4, 0x1039
+  WRITE_32            0x21A00E8, 0x103A
+  WRITE_32            0x21A00EC, 0x103B
+  WRITE_32            0x21A00F0, 0x103C
+  WRITE_32            0x21A00F4, 0x103D
+  WRITE_32            0x21A00F8, 0x103E
+  WRITE_32            0x21A00FC, 0x103F
+  WRITE_32            0x21A0100, 0x1040
+  WRITE_32            0x21A0104, 0x1041
+  WRITE_32            0x21A0108, 0x1042
+  WRITE_32            0x21A010C, 0x1043
+  WRITE_32            0x21A0110, 0x1044
+  WRITE_32            0x21A0114, 0x1045
+  WRITE_32            0x21A0118, 0x1046
+  WRITE_32            0x21A011C, 0x1047
+  WRITE_32            0x21A0120, 0x1048
+  WRITE_32            0x21A0124, 0x1049
+  WRITE_32            0x21A0128, 0x104A
+  WRITE_32            0x21A012C, 0x104B
+  WRITE_32            0x21A0130, 0x104C
+  WRITE_32            0x21A0134, 0x104D
+  WRITE_32            0x21A0138, 0x104E
+  WRITE_32            0x21A013C, 0x104F
+  WRITE_32            0x21A0140, 0x1050
+  WRITE_32            0x21A0144, 0x1051
+  WRITE_32            0x21A0148, 0x1052
+  WRITE_32            0x21A014C, 0x1053
+  WRITE_32            0x21A0150, 0x1054
+  WRITE_32            0x21A0154, 0x1055
+  WRITE_32            0x21A0158, 0x1056
+  WRITE_32            0x21A015C, 0x1057
+  WRITE_32            0x21A0160, 0x1058
+  WRITE_32            0x21A0164, 0x1059
+  WRITE_32            0x21A0168, 0x105A
+  WRITE_32            0x21A016C, 0x105B
+  WRITE_32            0x21A0170, 0x105C
+  WRITE_32            0x21A0174, 0x105D
+  WRITE_32            0x21A0178, 0x105E
+  WRITE_32            0x21A017C, 0x105F
+  WRITE_32            0x21A0180, 0x1060
+  WRITE_32            0x21A0184, 0x1061
+  WRITE_32            0x21A0188, 0x1062
+  WRITE_32            0x21A018C, 0x1063
+  WRITE_32            0x21A0190, 0x1064
+  WRITE_32            0x21A0194, 0x1065
+  WRITE_32            0x21A0198, 0x1066
+  WRITE_32            0x21A019C, 0x1067
+  WRITE_32            0x21A01A0, 0x1068
+  WRITE_32            0x21A01A4, 0x1069
+  WRITE_32            0x21A01A8, 0x106A
+  WRITE_32            0x21A01AC, 0x106B
+  WRITE_32            0x21A01B0, 0x106C
+  WRITE_32            0x21A01B4, 0x106D
+  WRITE_32            0x21A01B8, 0x106E
+  WRITE_32            0x21A01BC, 0x106F
+  WRITE_32            0x21A01C0, 0x1070
+  WRITE_32            0x21A01C4, 0x1071
+  WRITE_32            0x21A01C8, 0x1072
+  WRITE_32            0x21A01CC, 0x1073
+  WRITE_32            0x21A01D0, 0x1074
+  WRITE_32            0x21A01D4, 0x1075
+  WRITE_32            0x21A01D8, 0x1076
+  WRITE_32            0x21A01DC, 0x1077
+  WRITE_32            0x21A01E0, 0x1078
+  WRITE_32            0x21A01E4, 0x1079
+  WRITE_32            0x21A01E8, 0x107A
+  WRITE_32            0x21A01EC, 0x107B
+  WRITE_32            0x21A01F0, 0x107C
+  WRITE_32            0x21A01F4, 0x107D
+  WRITE_32            0x21A01F8, 0x107E
+  WRITE_32            0x21A01FC, 0x107F
+  WRITE_32            0x21A0200, 0x1080
+  WRITE_32            0x21A0204, 0x1081
+  WRITE_32            0x21A0208, 0x1082
+  WRITE_32            0x21A020C, 0x1083
+  WRITE_32            0x21A0210, 0x1084
+  WRITE_32            0x21A0214, 0x1085
+  WRITE_32            0x21A0218, 0x1086
+  WRITE_32            0x21A021C, 0x1087
+  WRITE_32            0x21A0220, 0x1088
+  WRITE_32            0x21A0224, 0x1089
+  WRITE_32            0x21A0228, 0x108A
+  WRITE_32            0x21A022C, 0x108B
+  WRITE_32            0x21A0230, 0x108C
+  WRITE_32            0x21A0234, 0x108D
+  WRITE_32            0x21A0238, 0x108E
+  WRITE_32            0x21A023C, 0x108F
+  WRITE_32            0x21A0240, 0x1090
+  WRITE_32            0x21A0244, 0x1091
+  WRITE_32            0x21A0248, 0x1092
+  WRITE_32            0x21A024C, 0x1093
+  WRITE_32            0x21A0250, 0x1094
+  WRITE_32            0x21A0254, 0x1095
+  WRITE_32            0x21A0258, 0x1096
+  WRITE_32            0x21A025C, 0x1097
+  WRITE_32            0x21A0260, 0x1098
+  WRITE_32            0x21A0264, 0x1099
+  WRITE_32            0x21A0268, 0x109A
+  WRITE_32            0x21A026C, 0x109B
+  WRITE_32            0x21A0270, 0x109C
+  WRITE_32            0x21A0274, 0x109D
+  WRITE_32            0x21A0278, 0x109E
+  WRITE_32            0x21A027C, 0x109F
+  WRITE_32            0x21A0280, 0x10A0
+  WRITE_32            0x21A0284, 0x10A1
+  WRITE_32            0x21A0288, 0x10A2
+  WRITE_32            0x21A028C, 0x10A3
+  WRITE_32            0x21A0290, 0x10A4
+  WRITE_32            0x21A0294, 0x10A5
+  WRITE_32            0x21A0298, 0x10A6
+  WRITE_32            0x21A029C, 0x10A7
+  WRITE_32            0x21A02A0, 0x10A8
+  WRITE_32            0x21A02A4, 0x10A9
+  WRITE_32            0x21A02A8, 0x10AA
+  WRITE_32            0x21A02AC, 0x10AB
+  WRITE_32            0x21A02B0, 0x10AC
+  WRITE_32            0x21A02B4, 0x10AD
+  WRITE_32            0x21A02B8, 0x10AE
+  WRITE_32            0x21A02BC, 0x10AF
+  WRITE_32            0x21A02C0, 0x10B0
+  WRITE_32            0x21A02C4, 0x10B1
+  WRITE_32            0x21A02C8, 0x10B2
+  WRITE_32            0x21A02CC, 0x10B3
+  WRITE_32            0x21A02D0, 0x10B4
+  WRITE_32            0x21A02D4, 0x10B5
+  WRITE_32            0x21A02D8, 0x10B6
+  WRITE_32            0x21A02DC, 0x10B7
+  WRITE_32            0x21A02E0, 0x10B8
+  WRITE_32            0x21A02E4, 0x10B9
+  WRITE_32            0x21A02E8, 0x10BA
+  WRITE_32            0x21A02EC, 0x10BB
+  WRITE_32            0x21A02F0, 0x10BC
+  WRITE_32            0x21A02F4, 0x10BD
+  WRITE_32            0x21A02F8, 0x10BE
+  WRITE_32            0x21A02FC, 0x10BF
+  WRITE_32            0x21A0300, 0x10C0
+  WRITE_32            0x21A0304, 0x10C1
+  WRITE_32            0x21A0308, 0x10C2
+  WRITE_32            0x21A030C, 0x10C3
+  WRITE_32            0x21A0310, 0x10C4
+  WRITE_32            0x21A0314, 0x10C5
+  WRITE_32            0x21A0318, 0x10C6
+  WRITE_32            0x21A031C, 0x10C7
+  WRITE_32            0x21A0320, 0x10C8
+  WRITE_32            0x21A0324, 0x10C9
+  WRITE_32            0x21A0328, 0x10CA
+  WRITE_32            0x21A032C, 0x10CB
+  WRITE_32            0x21A0330, 0x10CC
+  WRITE_32            0x21A0334, 0x10CD
+  WRITE_32            0x21A0338, 0x10CE
+  WRITE_32            0x21A033C, 0x10CF
+  WRITE_32            0x21A0340, 0x10D0
+  WRITE_32            0x21A0344, 0x10D1
+  WRITE_32            0x21A0348, 0x10D2
+  WRITE_32            0x21A034C, 0x10D3
+  WRITE_32            0x21A0350, 0x10D4
+  WRITE_32            0x21A0354, 0x10D5
+  WRITE_32            0x21A0358, 0x10D6
+  WRITE_32            0x21A035C, 0x10D7
+  WRITE_32            0x21A0360, 0x10D8
+  WRITE_32            0x21A0364, 0x10D9
+  WRITE_32            0x21A0368, 0x10DA
+  WRITE_32            0x21A036C, 0x10DB
+  WRITE_32            0x21A0370, 0x10DC
+  WRITE_32            0x21A0374, 0x10DD
+  WRITE_32            0x21A0378, 0x10DE
+  WRITE_32            0x21A037C, 0x10DF
+  WRITE_32            0x21A0380, 0x10E0
+  WRITE_32            0x21A0384, 0x10E1
+  WRITE_32            0x21A0388, 0x10E2
+  WRITE_32            0x21A038C, 0x10E3
+  WRITE_32            0x21A0390, 0x10E4
+  WRITE_32            0x21A0394, 0x10E5
+  WRITE_32            0x21A0398, 0x10E6
+  WRITE_32            0x21A039C, 0x10E7
+  WRITE_32            0x21A03A0, 0x10E8
+  WRITE_32            0x21A03A4, 0x10E9
+  WRITE_32            0x21A03A8, 0x10EA
+  WRITE_32            0x21A03AC, 0x10EB
+  WRITE_32            0x21A03B0, 0x10EC
+  WRITE_32            0x21A03B4, 0x10ED
+  WRITE_32            0x21A03B8, 0x10EE
+  WRITE_32            0x21A03BC, 0x10EF
+  WRITE_32            0x21A03C0, 0x10F0
+  WRITE_32            0x21A03C4, 0x10F1
+  WRITE_32            0x21A03C8, 0x10F2
+  WRITE_32            0x21A03CC, 0x10F3
+  WRITE_32            0x21A03D0, 0x10F4
+  WRITE_32            0x21A03D4, 0x10F5
+  WRITE_32            0x21A03D8, 0x10F6
+  WRITE_32            0x21A03DC, 0x10F7
+  WRITE_32            0x21A03E0, 0x10F8
+  WRITE_32            0x21A03E4, 0x10F9
+  WRITE_32            0x21A03E8, 0x10FA
+  WRITE_32            0x21A03EC, 0x10FB
+  WRITE_32            0x21A03F0, 0x10FC
+  WRITE_32            0x21A03F4, 0x10FD
+  WRITE_32            0x21A03F8, 0x10FE
+  WRITE_32            0x21A03FC, 0x10FF
+  WRITE_32            0x21A0400, 0x1100
+  WRITE_32            0x21A0404, 0x1101
+  WRITE_32            0x21A0408, 0x1102
+  WRITE_32            0x21A040C, 0x1103
+  WRITE_32            0x21A0410, 0x1104
+  WRITE_32            0x21A0414, 0x1105
+  WRITE_32            0x21A0418, 0x1106
+  WRITE_32            0x21A041C, 0x1107
+  WRITE_32            0x21A0420, 0x1108
+  WRITE_32            0x21A0424, 0x1109
+  WRITE_32            0x21A0428, 0x110A
+  WRITE_32            0x21A042C, 0x110B
+  WRITE_32            0x21A0430, 0x110C
+  WRITE_32            0x21A0434, 0x110D
+  WRITE_32            0x21A0438, 0x110E
+  WRITE_32            0x21A043C, 0x110F
+  WRITE_32            0x21A0440, 0x1110
+  WRITE_32            0x21A0444, 0x1111
+  WRITE_32            0x21A0448, 0x1112
+  WRITE_32            0x21A044C, 0x1113
+  WRITE_32            0x21A0450, 0x1114
+  WRITE_32            0x21A0454, 0x1115
+  WRITE_32            0x21A0458, 0x1116
+  WRITE_32            0x21A045C, 0x1117
+  WRITE_32            0x21A0460, 0x1118
+  WRITE_32            0x21A0464, 0x1119
+  WRITE_32            0x21A0468, 0x111A
+  WRITE_32            0x21A046C, 0x111B
+  WRITE_32            0x21A0470, 0x111C
+  WRITE_32            0x21A0474, 0x111D
+  WRITE_32            0x21A0478, 0x111E
+  WRITE_32            0x21A047C, 0x111F
+  WRITE_32            0x21A0480, 0x1120
+  WRITE_32            0x21A0484, 0x1121
+  WRITE_32            0x21A0488, 0x1122
+  WRITE_32            0x21A048C, 0x1123
+  WRITE_32            0x21A0490, 0x1124
+  WRITE_32            0x21A0494, 0x1125
+  WRITE_32            0x21A0498, 0x1126
+  WRITE_32            0x21A049C, 0x1127
+  WRITE_32            0x21A04A0, 0x1128
+  WRITE_32            0x21A04A4, 0x1129
+  WRITE_32            0x21A04A8, 0x112A
+  WRITE_32            0x21A04AC, 0x112B
+  WRITE_32            0x21A04B0, 0x112C
+  WRITE_32            0x21A04B4, 0x112D
+  WRITE_32            0x21A04B8, 0x112E
+  WRITE_32            0x21A04BC, 0x112F
+  WRITE_32            0x21A04C0, 0x1130
+  WRITE_32            0x21A04C4, 0x1131
+  WRITE_32            0x21A04C8, 0x1132
+  WRITE_32            0x21A04CC, 0x1133
+  WRITE_32            0x21A04D0, 0x1134
+  WRITE_32            0x21A04D4, 0x1135
+  WRITE_32            0x21A04D8, 0x1136
+  WRITE_32            0x21A04DC, 0x1137
+  WRITE_32            0x21A04E0, 0x1138
+  WRITE_32            0x21A04E4, 0x1139
+  WRITE_32            0x21A04E8, 0x113A
+  WRITE_32            0x21A04EC, 0x113B
+  WRITE_32            0x21A04F0, 0x113C
+  WRITE_32            0x21A04F4, 0x113D
+  WRITE_32            0x21A04F8, 0x113E
+  WRITE_32            0x21A04FC, 0x113F
+  WRITE_32            0x21A0500, 0x1140
+  WRITE_32            0x21A0504, 0x1141
+  WRITE_32            0x21A0508, 0x1142
+  WRITE_32            0x21A050C, 0x1143
+  WRITE_32            0x21A0510, 0x1144
+  WRITE_32            0x21A0514, 0x1145
+  WRITE_32            0x21A0518, 0x1146
+  WRITE_32            0x21A051C, 0x1147
+  WRITE_32            0x21A0520, 0x1148
+  WRITE_32            0x21A0524, 0x1149
+  WRITE_32            0x21A0528, 0x114A
+  WRITE_32            0x21A052C, 0x114B
+  WRITE_32            0x21A0530, 0x114C
+  WRITE_32            0x21A0534, 0x114D
+  WRITE_32            0x21A0538, 0x114E
+  WRITE_32            0x21A053C, 0x114F
+  WRITE_32            0x21A0540, 0x1150
+  WRITE_32            0x21A0544, 0x1151
+  WRITE_32            0x21A0548, 0x1152
+  WRITE_32            0x21A054C, 0x1153
+  WRITE_32            0x21A0550, 0x1154
+  WRITE_32            0x21A0554, 0x1155
+  WRITE_32            0x21A0558, 0x1156
+  WRITE_32            0x21A055C, 0x1157
+  WRITE_32            0x21A0560, 0x1158
+  WRITE_32            0x21A0564, 0x1159
+  WRITE_32            0x21A0568, 0x115A
+  WRITE_32            0x21A056C, 0x115B
+  WRITE_32            0x21A0570, 0x115C
+  WRITE_32            0x21A0574, 0x115D
+  WRITE_32            0x21A0578, 0x115E
+  WRITE_32            0x21A057C, 0x115F
+  WRITE_32            0x21A0580, 0x1160
+  WRITE_32            0x21A0584, 0x1161
+  WRITE_32            0x21A0588, 0x1162
+  WRITE_32            0x21A058C, 0x1163
+  WRITE_32            0x21A0590, 0x1164
+  WRITE_32            0x21A0594, 0x1165
+  WRITE_32            0x21A0598, 0x1166
+  WRITE_32            0x21A059C, 0x1167
+  WRITE_32            0x21A05A0, 0x1168
+  WRITE_32            0x21A05A4, 0x1169
+  WRITE_32            0x21A05A8, 0x116A
+  WRITE_32            0x21A05AC, 0x116B
+  WRITE_32            0x21A05B0, 0x116C
+  WRITE_32            0x21A05B4, 0x116D
+  WRITE_32            0x21A05B8, 0x116E
+  WRITE_32            0x21A05BC, 0x116F
+  WRITE_32            0x21A05C0, 0x1170
+  WRITE_32            0x21A05C4, 0x1171
+END_JOB
+
+START_JOB 2
+  WRITE_32            0x41A0000, 0x2000
+  WRITE_32            0x41A0004, 0x2001
+  WRITE_32            0x41A0008, 0x2002
+  WRITE_32            0x41A000C, 0x2003
+  WRITE_32            0x41A0010, 0x2004
+  WRITE_32            0x41A0014, 0x2005
+  WRITE_32            0x41A0018, 0x2006
+  WRITE_32            0x41A001C, 0x2007
+  WRITE_32            0x41A0020, 0x2008
+  WRITE_32            0x41A0024, 0x2009
+  WRITE_32            0x41A0028, 0x200A
+  WRITE_32            0x41A002C, 0x200B
+  WRITE_32            0x41A0030, 0x200C
+  WRITE_32            0x41A0034, 0x200D
+  WRITE_32            0x41A0038, 0x200E
+  WRITE_32            0x41A003C, 0x200F
+  WRITE_32            0x41A0040, 0x2010
+  WRITE_32            0x41A0044, 0x2011
+  WRITE_32            0x41A0048, 0x2012
+  WRITE_32            0x41A004C, 0x2013
+  WRITE_32            0x41A0050, 0x2014
+  WRITE_32            0x41A0054, 0x2015
+  WRITE_32            0x41A0058, 0x2016
+  WRITE_32            0x41A005C, 0x2017
+  WRITE_32            0x41A0060, 0x2018
+  WRITE_32            0x41A0064, 0x2019
+  WRITE_32            0x41A0068, 0x201A
+  WRITE_32            0x41A006C, 0x201B
+  WRITE_32            0x41A0070, 0x201C
+  WRITE_32            0x41A0074, 0x201D
+  WRITE_32            0x41A0078, 0x201E
+  WRITE_32            0x41A007C, 0x201F
+  WRITE_32            0x41A0080, 0x2020
+  WRITE_32            0x41A0084, 0x2021
+  WRITE_32            0x41A0088, 0x2022
+  WRITE_32            0x41A008C, 0x2023
+  WRITE_32            0x41A0090, 0x2024
+  WRITE_32            0x41A0094, 0x2025
+  WRITE_32            0x41A0098, 0x2026
+  WRITE_32            0x41A009C, 0x2027
+  WRITE_32            0x41A00A0, 0x2028
+  WRITE_32            0x41A00A4, 0x2029
+  WRITE_32            0x41A00A8, 0x202A
+  WRITE_32            0x41A00AC, 0x202B
+  WRITE_32            0x41A00B0, 0x202C
+  WRITE_32            0x41A00B4, 0x202D
+  WRITE_32            0x41A00B8, 0x202E
+  WRITE_32            0x41A00BC, 0x202F
+  WRITE_32            0x41A00C0, 0x2030
+  WRITE_32            0x41A00C4, 0x2031
+  WRITE_32            0x41A00C8, 0x2032
+  WRITE_32            0x41A00CC, 0x2033
+  WRITE_32            0x41A00D0, 0x2034
+  WRITE_32            0x41A00D4, 0x2035
+  WRITE_32            0x41A00D8, 0x2036
+  WRITE_32            0x41A00DC, 0x2037
+  WRITE_32            0x41A00E0, 0x2038
+  WRITE_32            0x41A00E4, 0x2039
+  WRITE_32            0x41A00E8, 0x203A
+  WRITE_32            0x41A00EC, 0x203B
+  WRITE_32            0x41A00F0, 0x203C
+  WRITE_32            0x41A00F4, 0x203D
+  WRITE_32            0x41A00F8, 0x203E
+  WRITE_32            0x41A00FC, 0x203F
+  WRITE_32            0x41A0100, 0x2040
+  WRITE_32            0x41A0104, 0x2041
+  WRITE_32            0x41A0108, 0x2042
+  WRITE_32            0x41A010C, 0x2043
+  WRITE_32            0x41A0110, 0x2044
+  WRITE_32            0x41A0114, 0x2045
+  WRITE_32            0x41A0118, 0x2046
+  WRITE_32            0x41A011C, 0x2047
+  WRITE_32            0x41A0120, 0x2048
+  WRITE_32            0x41A0124, 0x2049
+  WRITE_32            0x41A0128, 0x204A
+  WRITE_32            0x41A012C, 0x204B
+  WRITE_32            0x41A0130, 0x204C
+  WRITE_32            0x41A0134, 0x204D
+  WRITE_32            0x41A0138, 0x204E
+  WRITE_32            0x41A013C, 0x204F
+  WRITE_32            0x41A0140, 0x2050
+  WRITE_32            0x41A0144, 0x2051
+  WRITE_32            0x41A0148, 0x2052
+  WRITE_32            0x41A014C, 0x2053
+  WRITE_32            0x41A0150, 0x2054
+  WRITE_32            0x41A0154, 0x2055
+  WRITE_32            0x41A0158, 0x2056
+  WRITE_32            0x41A015C, 0x2057
+  WRITE_32            0x41A0160, 0x2058
+  WRITE_32            0x41A0164, 0x2059
+  WRITE_32            0x41A0168, 0x205A
+  WRITE_32            0x41A016C, 0x205B
+  WRITE_32            0x41A0170, 0x205C
+  WRITE_32            0x41A0174, 0x205D
+  WRITE_32            0x41A0178, 0x205E
+  WRITE_32            0x41A017C, 0x205F
+  WRITE_32            0x41A0180, 0x2060
+  WRITE_32            0x41A0184, 0x2061
+  WRITE_32            0x41A0188, 0x2062
+  WRITE_32            0x41A018C, 0x2063
+  WRITE_32            0x41A0190, 0x2064
+  WRITE_32            0x41A0194, 0x2065
+  WRITE_32            0x41A0198, 0x2066
+  WRITE_32            0x41A019C, 0x2067
+  WRITE_32            0x41A01A0, 0x2068
+  WRITE_32            0x41A01A4, 0x2069
+  WRITE_32            0x41A01A8, 0x206A
+  WRITE_32            0x41A01AC, 0x206B
+  WRITE_32            0x41A01B0, 0x206C
+  WRITE_32            0x41A01B4, 0x206D
+  WRITE_32            0x41A01B8, 0x206E
+  WRITE_32            0x41A01BC, 0x206F
+  WRITE_32            0x41A01C0, 0x2070
+  WRITE_32            0x41A01C4, 0x2071
+  WRITE_32            0x41A01C8, 0x2072
+  WRITE_32            0x41A01CC, 0x2073
+  WRITE_32            0x41A01D0, 0x2074
+  WRITE_32            0x41A01D4, 0x2075
+  WRITE_32            0x41A01D8, 0x2076
+  WRITE_32            0x41A01DC, 0x2077
+  WRITE_32            0x41A01E0, 0x2078
+  WRITE_32            0x41A01E4, 0x2079
+  WRITE_32            0x41A01E8, 0x207A
+  WRITE_32            0x41A01EC, 0x207B
+  WRITE_32            0x41A01F0, 0x207C
+  WRITE_32            0x41A01F4, 0x207D
+  WRITE_32            0x41A01F8, 0x207E
+  WRITE_32            0x41A01FC, 0x207F
+  WRITE_32            0x41A0200, 0x2080
+  WRITE_32            0x41A0204, 0x2081
+  WRITE_32            0x41A0208, 0x2082
+  WRITE_32            0x41A020C, 0x2083
+  WRITE_32            0x41A0210, 0x2084
+  WRITE_32            0x41A0214, 0x2085
+  WRITE_32            0x41A0218, 0x2086
+  WRITE_32            0x41A021C, 0x2087
+  WRITE_32            0x41A0220, 0x2088
+  WRITE_32            0x41A0224, 0x2089
+  WRITE_32            0x41A0228, 0x208A
+  WRITE_32            0x41A022C, 0x208B
+  WRITE_32            0x41A0230, 0x208C
+  WRITE_32            0x41A0234, 0x208D
+  WRITE_32            0x41A0238, 0x208E
+  WRITE_32            0x41A023C, 0x208F
+  WRITE_32            0x41A0240, 0x2090
+  WRITE_32            0x41A0244, 0x2091
+  WRITE_32            0x41A0248, 0x2092
+  WRITE_32            0x41A024C, 0x2093
+  WRITE_32            0x41A0250, 0x2094
+  WRITE_32            0x41A0254, 0x2095
+  WRITE_32            0x41A0258, 0x2096
+  WRITE_32            0x41A025C, 0x2097
+  WRITE_32            0x41A0260, 0x2098
+  WRITE_32            0x41A0264, 0x2099
+  WRITE_32            0x41A0268, 0x209A
+  WRITE_32            0x41A026C, 0x209B
+  WRITE_32            0x41A0270, 0x209C
+  WRITE_32            0x41A0274, 0x209D
+  WRITE_32            0x41A0278, 0x209E
+  WRITE_32            0x41A027C, 0x209F
+  WRITE_32            0x41A0280, 0x20A0
+  WRITE_32            0x41A0284, 0x20A1
+  WRITE_32            0x41A0288, 0x20A2
+  WRITE_32            0x41A028C, 0x20A3
+  WRITE_32            0x41A0290, 0x20A4
+  WRITE_32            0x41A0294, 0x20A5
+  WRITE_32            0x41A0298, 0x20A6
+  WRITE_32            0x41A029C, 0x20A7
+  WRITE_32            0x41A02A0, 0x20A8
+  WRITE_32            0x41A02A4, 0x20A9
+  WRITE_32            0x41A02A8, 0x20AA
+  WRITE_32            0x41A02AC, 0x20AB
+  WRITE_32            0x41A02B0, 0x20AC
+  WRITE_32            0x41A02B4, 0x20AD
+  WRITE_32            0x41A02B8, 0x20AE
+  WRITE_32            0x41A02BC, 0x20AF
+  WRITE_32            0x41A02C0, 0x20B0
+  WRITE_32            0x41A02C4, 0x20B1
+  WRITE_32            0x41A02C8, 0x20B2
+  WRITE_32            0x41A02CC, 0x20B3
+  WRITE_32            0x41A02D0, 0x20B4
+  WRITE_32            0x41A02D4, 0x20B5
+  WRITE_32            0x41A02D8, 0x20B6
+  WRITE_32            0x41A02DC, 0x20B7
+  WRITE_32            0x41A02E0, 0x20B8
+  WRITE_32            0x41A02E4, 0x20B9
+  WRITE_32            0x41A02E8, 0x20BA
+  WRITE_32            0x41A02EC, 0x20BB
+  WRITE_32            0x41A02F0, 0x20BC
+  WRITE_32            0x41A02F4, 0x20BD
+  WRITE_32            0x41A02F8, 0x20BE
+  WRITE_32            0x41A02FC, 0x20BF
+  WRITE_32            0x41A0300, 0x20C0
+  WRITE_32            0x41A0304, 0x20C1
+  WRITE_32            0x41A0308, 0x20C2
+  WRITE_32            0x41A030C, 0x20C3
+  WRITE_32            0x41A0310, 0x20C4
+  WRITE_32            0x41A0314, 0x20C5
+  WRITE_32            0x41A0318, 0x20C6
+  WRITE_32            0x41A031C, 0x20C7
+END_JOB
+
+START_JOB 3
+  WRITE_32            0x61A0000, 0x3000
+  WRITE_32            0x61A0004, 0x3001
+  WRITE_32            0x61A0008, 0x3002
+  WRITE_32            0x61A000C, 0x3003
+  WRITE_32            0x61A0010, 0x3004
+  WRITE_32            0x61A0014, 0x3005
+  WRITE_32            0x61A0018, 0x3006
+  WRITE_32            0x61A001C, 0x3007
+  WRITE_32            0x61A0020, 0x3008
+  WRITE_32            0x61A0024, 0x3009
+  WRITE_32            0x61A0028, 0x300A
+  WRITE_32            0x61A002C, 0x300B
+  WRITE_32            0x61A0030, 0x300C
+  WRITE_32            0x61A0034, 0x300D
+  WRITE_32            0x61A0038, 0x300E
+  WRITE_32            0x61A003C, 0x300F
+  WRITE_32            0x61A0040, 0x3010
+  WRITE_32            0x61A0044, 0x3011
+  WRITE_32            0x61A0048, 0x3012
+  WRITE_32            0x61A004C, 0x3013
+  WRITE_32            0x61A0050, 0x3014
+  WRITE_32            0x61A0054, 0x3015
+  WRITE_32            0x61A0058, 0x3016
+  WRITE_32            0x61A005C, 0x3017
+  WRITE_32            0x61A0060, 0x3018
+  WRITE_32            0x61A0064, 0x3019
+  WRITE_32            0x61A0068, 0x301A
+  WRITE_32            0x61A006C, 0x301B
+  WRITE_32            0x61A0070, 0x301C
+  WRITE_32            0x61A0074, 0x301D
+  WRITE_32            0x61A0078, 0x301E
+  WRITE_32            0x61A007C, 0x301F
+  WRITE_32            0x61A0080, 0x3020
+  WRITE_32            0x61A0084, 0x3021
+  WRITE_32            0x61A0088, 0x3022
+  WRITE_32            0x61A008C, 0x3023
+  WRITE_32            0x61A0090, 0x3024
+  WRITE_32            0x61A0094, 0x3025
+  WRITE_32            0x61A0098, 0x3026
+  WRITE_32            0x61A009C, 0x3027
+  WRITE_32            0x61A00A0, 0x3028
+  WRITE_32            0x61A00A4, 0x3029
+  WRITE_32            0x61A00A8, 0x302A
+  WRITE_32            0x61A00AC, 0x302B
+  WRITE_32            0x61A00B0, 0x302C
+  WRITE_32            0x61A00B4, 0x302D
+  WRITE_32            0x61A00B8, 0x302E
+  WRITE_32            0x61A00BC, 0x302F
+  WRITE_32            0x61A00C0, 0x3030
+  WRITE_32            0x61A00C4, 0x3031
+  WRITE_32            0x61A00C8, 0x3032
+  WRITE_32            0x61A00CC, 0x3033
+  WRITE_32            0x61A00D0, 0x3034
+  WRITE_32            0x61A00D4, 0x3035
+  WRITE_32            0x61A00D8, 0x3036
+  WRITE_32            0x61A00DC, 0x3037
+  WRITE_32            0x61A00E0, 0x3038
+  WRITE_32            0x61A00E4, 0x3039
+  WRITE_32            0x61A00E8, 0x303A
+  WRITE_32            0x61A00EC, 0x303B
+  WRITE_32            0x61A00F0, 0x303C
+  WRITE_32            0x61A00F4, 0x303D
+  WRITE_32            0x61A00F8, 0x303E
+  WRITE_32            0x61A00FC, 0x303F
+  WRITE_32            0x61A0100, 0x3040
+  WRITE_32            0x61A0104, 0x3041
+  WRITE_32            0x61A0108, 0x3042
+  WRITE_32            0x61A010C, 0x3043
+  WRITE_32            0x61A0110, 0x3044
+  WRITE_32            0x61A0114, 0x3045
+  WRITE_32            0x61A0118, 0x3046
+  WRITE_32            0x61A011C, 0x3047
+  WRITE_32            0x61A0120, 0x3048
+  WRITE_32            0x61A0124, 0x3049
+  WRITE_32            0x61A0128, 0x304A
+  WRITE_32            0x61A012C, 0x304B
+  WRITE_32            0x61A0130, 0x304C
+  WRITE_32            0x61A0134, 0x304D
+  WRITE_32            0x61A0138, 0x304E
+  WRITE_32            0x61A013C, 0x304F
+  WRITE_32            0x61A0140, 0x3050
+  WRITE_32            0x61A0144, 0x3051
+  WRITE_32            0x61A0148, 0x3052
+  WRITE_32            0x61A014C, 0x3053
+  WRITE_32            0x61A0150, 0x3054
+  WRITE_32            0x61A0154, 0x3055
+  WRITE_32            0x61A0158, 0x3056
+  WRITE_32            0x61A015C, 0x3057
+  WRITE_32            0x61A0160, 0x3058
+  WRITE_32            0x61A0164, 0x3059
+  WRITE_32            0x61A0168, 0x305A
+  WRITE_32            0x61A016C, 0x305B
+  WRITE_32            0x61A0170, 0x305C
+  WRITE_32            0x61A0174, 0x305D
+  WRITE_32            0x61A0178, 0x305E
+  WRITE_32            0x61A017C, 0x305F
+  WRITE_32            0x61A0180, 0x3060
+  WRITE_32            0x61A0184, 0x3061
+  WRITE_32            0x61A0188, 0x3062
+  WRITE_32            0x61A018C, 0x3063
+  WRITE_32            0x61A0190, 0x3064
+  WRITE_32            0x61A0194, 0x3065
+  WRITE_32            0x61A0198, 0x3066
+  WRITE_32            0x61A019C, 0x3067
+  WRITE_32            0x61A01A0, 0x3068
+  WRITE_32            0x61A01A4, 0x3069
+  WRITE_32            0x61A01A8, 0x306A
+  WRITE_32            0x61A01AC, 0x306B
+  WRITE_32            0x61A01B0, 0x306C
+  WRITE_32            0x61A01B4, 0x306D
+  WRITE_32            0x61A01B8, 0x306E
+  WRITE_32            0x61A01BC, 0x306F
+  WRITE_32            0x61A01C0, 0x3070
+  WRITE_32            0x61A01C4, 0x3071
+  WRITE_32            0x61A01C8, 0x3072
+  WRITE_32            0x61A01CC, 0x3073
+  WRITE_32            0x61A01D0, 0x3074
+  WRITE_32            0x61A01D4, 0x3075
+  WRITE_32            0x61A01D8, 0x3076
+  WRITE_32            0x61A01DC, 0x3077
+  WRITE_32            0x61A01E0, 0x3078
+  WRITE_32            0x61A01E4, 0x3079
+  WRITE_32            0x61A01E8, 0x307A
+  WRITE_32            0x61A01EC, 0x307B
+  WRITE_32            0x61A01F0, 0x307C
+  WRITE_32            0x61A01F4, 0x307D
+  WRITE_32            0x61A01F8, 0x307E
+  WRITE_32            0x61A01FC, 0x307F
+  WRITE_32            0x61A0200, 0x3080
+  WRITE_32            0x61A0204, 0x3081
+  WRITE_32            0x61A0208, 0x3082
+  WRITE_32            0x61A020C, 0x3083
+  WRITE_32            0x61A0210, 0x3084
+  WRITE_32            0x61A0214, 0x3085
+  WRITE_32            0x61A0218, 0x3086
+  WRITE_32            0x61A021C, 0x3087
+  WRITE_32            0x61A0220, 0x3088
+  WRITE_32            0x61A0224, 0x3089
+  WRITE_32            0x61A0228, 0x308A
+  WRITE_32            0x61A022C, 0x308B
+  WRITE_32            0x61A0230, 0x308C
+  WRITE_32            0x61A0234, 0x308D
+  WRITE_32            0x61A0238, 0x308E
+  WRITE_32            0x61A023C, 0x308F
+  WRITE_32            0x61A0240, 0x3090
+  WRITE_32            0x61A0244, 0x3091
+  WRITE_32            0x61A0248, 0x3092
+  WRITE_32            0x61A024C, 0x3093
+  WRITE_32            0x61A0250, 0x3094
+  WRITE_32            0x61A0254, 0x3095
+  WRITE_32            0x61A0258, 0x3096
+  WRITE_32            0x61A025C, 0x3097
+  WRITE_32            0x61A0260, 0x3098
+  WRITE_32            0x61A0264, 0x3099
+  WRITE_32            0x61A0268, 0x309A
+  WRITE_32            0x61A026C, 0x309B
+  WRITE_32            0x61A0270, 0x309C
+  WRITE_32            0x61A0274, 0x309D
+  WRITE_32            0x61A0278, 0x309E
+  WRITE_32            0x61A027C, 0x309F
+  WRITE_32            0x61A0280, 0x30A0
+  WRITE_32            0x61A0284, 0x30A1
+  WRITE_32            0x61A0288, 0x30A2
+  WRITE_32            0x61A028C, 0x30A3
+  WRITE_32            0x61A0290, 0x30A4
+  WRITE_32            0x61A0294, 0x30A5
+  WRITE_32            0x61A0298, 0x30A6
+  WRITE_32            0x61A029C, 0x30A7
+  WRITE_32            0x61A02A0, 0x30A8
+  WRITE_32            0x61A02A4, 0x30A9
+  WRITE_32            0x61A02A8, 0x30AA
+  WRITE_32            0x61A02AC, 0x30AB
+  WRITE_32            0x61A02B0, 0x30AC
+  WRITE_32            0x61A02B4, 0x30AD
+  WRITE_32            0x61A02B8, 0x30AE
+  WRITE_32            0x61A02BC, 0x30AF
+  WRITE_32            0x61A02C0, 0x30B0
+  WRITE_32            0x61A02C4, 0x30B1
+  WRITE_32            0x61A02C8, 0x30B2
+  WRITE_32            0x61A02CC, 0x30B3
+  WRITE_32            0x61A02D0, 0x30B4
+  WRITE_32            0x61A02D4, 0x30B5
+  WRITE_32            0x61A02D8, 0x30B6
+  WRITE_32            0x61A02DC, 0x30B7
+  WRITE_32            0x61A02E0, 0x30B8
+  WRITE_32            0x61A02E4, 0x30B9
+  WRITE_32            0x61A02E8, 0x30BA
+  WRITE_32            0x61A02EC, 0x30BB
+  WRITE_32            0x61A02F0, 0x30BC
+  WRITE_32            0x61A02F4, 0x30BD
+  WRITE_32            0x61A02F8, 0x30BE
+  WRITE_32            0x61A02FC, 0x30BF
+  WRITE_32            0x61A0300, 0x30C0
+  WRITE_32            0x61A0304, 0x30C1
+  WRITE_32            0x61A0308, 0x30C2
+  WRITE_32            0x61A030C, 0x30C3
+  WRITE_32            0x61A0310, 0x30C4
+  WRITE_32            0x61A0314, 0x30C5
+  WRITE_32            0x61A0318, 0x30C6
+  WRITE_32            0x61A031C, 0x30C7
+END_JOB
+
+EOF
@@ -0,0 +1,19 @@
+;
+; Column 0, continued from unit_0.asm
+;
+
+.attach_to_group 0
+
+START_JOB 2
+  LOCAL_BARRIER       $lb0, 2
+  uC_DMA_WRITE_DES    $r1, @uc_dma_bd0
+  WAIT_uC_DMA         $r1
+  uC_DMA_WRITE_DES    $r1, @uc_dma_bd2
+  WAIT_uC_DMA         $r1
+END_JOB
+
+EOF
+
+  .align             16
+uc_dma_bd2:
+  UC_DMA_BD         0, 0x041A0000, @mem_bd1, 8, 0, 0
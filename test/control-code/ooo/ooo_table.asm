@@ -0,0 +1,60 @@
+;
+; page 0 loads four pdis, more than the two page header slots
+;
+.attach_to_group 0
+START_JOB 0
+  LOAD_PDI            0, @pdi0
+  LOAD_PDI            1, @pdi1
+  LOAD_PDI            2, @pdi2
+  LOAD_PDI            3, @pdi3
+END_JOB
+
+.eop
+
+START_JOB 1
+  WRITE_32            0x41a0600, 0x1
+END_JOB
+
+EOF
+
+.section .ctrltext
+pdi0:
+START_JOB 0
+  WRITE_32            0x41a0600, 0x0
+END_JOB
+
+EOF
+.endl pdi0
+
+.section .ctrltext
+pdi1:
+START_JOB 0
+  WRITE_32            0x41a0600, 0x1
+  WRITE_32            0x41a0604, 0x1
+END_JOB
+
+EOF
+.endl pdi1
+
+.section .ctrltext
+pdi2:
+START_JOB 0
+  WRITE_32            0x41a0600, 0x2
+  WRITE_32            0x41a0604, 0x2
+  WRITE_32            0x41a0608, 0x2
+END_JOB
+
+EOF
+.endl pdi2
+
+.section .ctrltext
+pdi3:
+START_JOB 0
+  WRITE_32            0x41a0600, 0x3
+  WRITE_32            0x41a0604, 0x3
+  WRITE_32            0x41a0608, 0x3
+  WRITE_32            0x41a060c, 0x3
+END_JOB
+
+EOF
+.endl pdi3
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025 Advanced Micro Devices, Inc.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aiebu_assembler.h"
+#include "aiebu_error.h"
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+/* Generates an aie2ps control code with <jobs> jobs of <ops> WRITE_32 each,
+ * followed by a data section with one label per job, and assembles it
+ * <iterations> times through the public API. Remaining arguments are passed
+ * as assembler flags, every iteration must produce the same ELF.
+ *   ./aie2ps_bench <jobs> [ops] [iterations] [flag...]
+ *
+ * With "barriers=<n>" every <n> consecutive jobs share a local barrier and
+ * each job writes the address of its data label, so pagination has to pull
+ * whole barrier groups and their labels into one page. A column has 16 local
+ * barriers, the groups are spread over as many columns as needed, e.g.
+ *   ./aie2ps_bench 10000 4 3 barriers=64
+ *
+ * With "fixture=<asm>" an existing control code (e.g. one of
+ * test/control-code) is replicated on <copies> columns instead, each copy
+ * attached to its own column:
+ *   ./aie2ps_bench fixture=<asm> <copies> [iterations] [flag...]
+ */
+
+// local barriers of a column, $lb0 .. $lb15
+constexpr unsigned int barriers_per_col = 16;
+
+void usage_exit()
+{
+  std::cout << "Usage: aie2ps_bench <jobs> [ops per job] [iterations] [barriers=<n>] [flag...]" << std::endl;
+  std::cout << "       aie2ps_bench fixture=<asm> <copies> [iterations] [flag...]" << std::endl;
+  exit(1);
+}
+
+static std::string
+generate_asm(unsigned int jobs, unsigned int ops, unsigned int group, unsigned int& lines)
+{
+  std::stringstream ss;
+  lines = 0;
+  unsigned int jobs_per_col = group ? group * barriers_per_col : jobs;
+  for (unsigned int first = 0; first < jobs; first += jobs_per_col) {
+    unsigned int last = std::min(jobs, first + jobs_per_col);
+    if (first) {
+      ss << ".attach_to_group " << first / jobs_per_col << "\n\n";
+      lines += 2;
+    }
+    ss << ";\n; Code\n;\n\n";
+    lines += 4;
+    for (unsigned int job = first; job < last; ++job) {
+      ss << "START_JOB " << job << "\n";
+      if (group) {
+        ss << "  LOCAL_BARRIER       $lb" << (job / group) % barriers_per_col << ", " << group << "\n";
+        ++lines;
+      }
+      for (unsigned int op = 0; op < ops; ++op) {
+        ss << "  WRITE_32            0x" << std::hex << (0x41A0600 + op * 4) << ", ";
+        if (group && !op)
+          ss << "@data_" << std::dec << job << "\n";
+        else
+          ss << "0x" << job << std::dec << "\n";
+      }
+      ss << "END_JOB\n\n";
+      lines += ops + 3;
+    }
+    ss << "EOF\n\n;\n; Data\n;\n\n";
+    lines += 6;
+    for (unsigned int job = first; job < last; ++job) {
+      ss << "  .align             4\n"
+         << "data_" << job << ":\n"
+         << "  .long              0x" << std::hex << job << std::dec << "\n\n";
+      lines += 4;
+    }
+  }
+  return ss.str();
+}
+
+static std::string
+replicate_asm(const std::string& file, unsigned int copies, unsigned int& lines)
+{
+  std::ifstream in(file);
+  if (!in)
+    throw std::runtime_error("cannot open " + file);
+  std::stringstream fixture;
+  fixture << in.rdbuf();
+  auto text = fixture.str();
+  auto fixture_lines = static_cast<unsigned int>(std::count(text.begin(), text.end(), '\n'));
+
+  std::stringstream ss;
+  lines = 0;
+  for (unsigned int col = 0; col < copies; ++col) {
+    ss << ".section .ctrltext\n.attach_to_group " << col << "\n" << text << "\n";
+    lines += fixture_lines + 3;
+  }
+  return ss.str();
+}
+
+// peak resident set size in KB, 0 where not available
+static long
+peak_rss_kb()
+{
+#if !defined(_WIN32)
+  struct rusage usage;
+  if (!getrusage(RUSAGE_SELF, &usage))
+    return usage.ru_maxrss;
+#endif
+  return 0;
+}
+
+int main(int argc, char ** argv)
+{
+  if (argc < 2)
+    usage_exit();
+
+  std::string fixture;
+  int argi = 1;
+  if (!std::string(argv[1]).rfind("fixture=", 0)) {
+    fixture = std::string(argv[1]).substr(8);
+    if (argc < 3)
+      usage_exit();
+    ++argi;
+  }
+
+  // with a fixture <jobs> is the number of copies and there is no [ops]
+  unsigned int jobs = std::stoul(argv[argi++]);
+  unsigned int ops = (fixture.empty() && argc > argi) ? std::stoul(argv[argi++]) : 8;
+  unsigned int iterations = (argc > argi) ? std::stoul(argv[argi++]) : 3;
+  if (!jobs || !iterations)
+    usage_exit();
+  unsigned int group = 0;
+  std::vector<std::string> flags;
+  for (int i = argi; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (!arg.rfind("barriers=", 0))
+      group = std::stoul(arg.substr(9));
+    else
+      flags.push_back(arg);
+  }
+
+  unsigned int lines = 0;
+  std::string text;
+  try
+  {
+    text = fixture.empty() ? generate_asm(jobs, ops, group, lines) : replicate_asm(fixture, jobs, lines);
+  }
+  catch (std::exception &ex)
+  {
+    std::cout << "ERROR: " << ex.what() << std::endl;
+    return 1;
+  }
+  std::vector<char> control_code_buf(text.begin(), text.end());
+
+  try
+  {
+    std::vector<char> first_elf;
+    double best = 0;
+    double total = 0;
+    for (unsigned int i = 0; i < iterations; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      auto as = aiebu::aiebu_assembler(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, control_code_buf,
+                                       {}, {}, {}, {}, {}, flags);
+      auto elf = as.get_elf();
+      std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+      if (!i)
+        first_elf = std::move(elf);
+      else if (elf != first_elf) {
+        std::cout << "ERROR: iteration " << i << " produced a different ELF" << std::endl;
+        return 1;
+      }
+      total += elapsed.count();
+      if (!i || elapsed.count() < best)
+        best = elapsed.count();
+    }
+    if (fixture.empty())
+      std::cout << "jobs: " << jobs << ", ops/job: " << ops << ", jobs/barrier: " << group;
+    else
+      std::cout << "fixture: " << fixture << ", copies: " << jobs;
+    std::cout << ", lines: " << lines << ", asm bytes: " << control_code_buf.size()
+              << ", elf bytes: " << first_elf.size() << std::endl;
+    std::cout << "best: " << best << " ms, mean: " << total / iterations << " ms, "
+              << static_cast<uint64_t>(lines / (best / 1000)) << " lines/s, peak rss: "
+              << peak_rss_kb() << " KB" << std::endl;
+  }
+  catch (aiebu::error &ex)
+  {
+    std::cout << "ERROR: " <<  ex.what() << ex.get_code() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
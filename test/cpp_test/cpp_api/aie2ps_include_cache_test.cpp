@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "aiebu_assembler.h"
+#include "aiebu_error.h"
+
+/* Assembles the same aie2ps asm twice in one process with the
+ * include_cache flag and edits its .include in between. The edit keeps
+ * the file size and the modification time, as a rewrite within the
+ * timestamp resolution of the file system does, so only the content tells
+ * the cache that the lexed include is stale. The second ELF must match an
+ * assembly of the edited source without the cache.
+ *   ./aie2ps_cpp_include_cache <work dir>
+ */
+
+static void
+write_include(const std::filesystem::path& file, const std::string& indent, const std::string& value)
+{
+  std::ofstream out(file, std::ios_base::trunc);
+  out << "START_JOB 0\n"
+      << indent << "WRITE_32" << std::string(14 - indent.size(), ' ') << "0x81A0634, " << value << "\n"
+      << "END_JOB\n"
+      << "\n"
+      << "EOF\n";
+}
+
+static std::vector<char>
+assemble(const std::vector<char>& asm_buf, const std::filesystem::path& dir,
+         const std::vector<std::string>& flags)
+{
+  aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, asm_buf, {}, {}, {},
+                            {dir.string()}, {}, flags);
+  return as.get_elf();
+}
+
+int main(int argc, char ** argv)
+{
+  if (argc != 2) {
+    std::cout << "Usage: aie2ps_cpp_include_cache <work dir>" << std::endl;
+    return 1;
+  }
+
+  std::filesystem::path dir(argv[1]);
+  std::filesystem::create_directories(dir);
+  auto include = dir / "include_cache_job.asm";
+  std::string source = ".attach_to_group 0\n.include include_cache_job.asm\n";
+  std::vector<char> asm_buf(source.begin(), source.end());
+
+  try
+  {
+    write_include(include, "  ", "0x80000000");
+    auto first = assemble(asm_buf, dir, {"include_cache"});
+
+    // same size and mtime, only the content changes and the operation
+    // moves within its line, stale views into the file would be garbage
+    auto mtime = std::filesystem::last_write_time(include);
+    write_include(include, "", "0x80000001");
+    std::filesystem::last_write_time(include, mtime);
+    auto second = assemble(asm_buf, dir, {"include_cache"});
+    auto fresh = assemble(asm_buf, dir, {});
+
+    if (first == second) {
+      std::cout << "ERROR: cached include was not reloaded after it changed" << std::endl;
+      return 1;
+    }
+    if (second != fresh) {
+      std::cout << "ERROR: assembly with include_cache differs from a fresh assembly" << std::endl;
+      return 1;
+    }
+  }
+  catch (aiebu::error &ex)
+  {
+    std::cout << "ERROR: " << ex.what() << ex.get_code() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "aiebu_assembler.h"
+#include "aiebu_error.h"
+
+/* Assembles a two column aie2ps asm with the incremental flag, then edits
+ * of it that leave column 0 alone: a BD of column 1, the content of a
+ * column 1 scratchpad file and the size of a column 1 scratchpad. Each
+ * incremental ELF reuses column 0 from the previous build and must match
+ * an assembly of the same source without the flag byte for byte.
+ *   ./aie2ps_cpp_incremental <work dir>
+ */
+
+static std::string
+source(const std::string& bd_word, uint32_t buf_words)
+{
+  return ".attach_to_group 0\n"
+         "START_JOB 0\n"
+         "  WRITE_32          0x81A0634, 0x80000000\n"
+         "  uC_DMA_WRITE_DES_SYNC @bd0\n"
+         "END_JOB\n"
+         "\n"
+         "EOF\n"
+         "\n"
+         "  .align             16\n"
+         "bd0:\n"
+         "  UC_DMA_BD         0, 0x001D0000, @tbl0, 8, 0, 0\n"
+         "\n"
+         "  .align             4\n"
+         "tbl0:\n"
+         "  .long              0x00000080\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x80000000\n"
+         "\n"
+         ".attach_to_group 1\n"
+         "START_JOB 0\n"
+         "  uC_DMA_WRITE_DES_SYNC @bd1\n"
+         "  uC_DMA_WRITE_DES_SYNC @bd2\n"
+         "END_JOB\n"
+         "\n"
+         "EOF\n"
+         "\n"
+         "  .align             16\n"
+         "bd1:\n"
+         "  UC_DMA_BD         0, 0x001D0000, @tbl1, 8, 0, 0\n"
+         "bd2:\n"
+         "  UC_DMA_BD         0, 0x001D0020, @weights, 8, 0, 0\n"
+         "\n"
+         "  .align             4\n"
+         "tbl1:\n"
+         "  .long              " + bd_word + "\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x00000000\n"
+         "  .long              0x80000000\n"
+         ".setpad weights, incremental_weights.bin\n"
+         ".setpad buf, " + std::to_string(buf_words) + "\n";
+}
+
+static void
+write_pad(const std::filesystem::path& file, char fill)
+{
+  std::ofstream out(file, std::ios_base::binary | std::ios_base::trunc);
+  out << std::string(64, fill);
+}
+
+static std::vector<char>
+assemble(const std::string& src, const std::filesystem::path& dir, const std::vector<std::string>& flags)
+{
+  std::vector<char> asm_buf(src.begin(), src.end());
+  aiebu::aiebu_assembler as(aiebu::aiebu_assembler::buffer_type::asm_aie2ps, asm_buf, {}, {}, {},
+                            {dir.string()}, {}, flags);
+  return as.get_elf();
+}
+
+// incremental build of src after the previous one, checked against a clean build
+static bool
+check(const std::string& what, const std::string& src, const std::filesystem::path& dir,
+      std::vector<char>& previous)
+{
+  auto incremental = assemble(src, dir, {"incremental"});
+  auto clean = assemble(src, dir, {});
+  if (incremental != clean) {
+    std::cout << "ERROR: incremental build differs from a clean build after " << what << std::endl;
+    return false;
+  }
+  if (incremental == previous) {
+    std::cout << "ERROR: " << what << " did not change the ELF" << std::endl;
+    return false;
+  }
+  previous = incremental;
+  return true;
+}
+
+int main(int argc, char ** argv)
+{
+  if (argc != 2) {
+    std::cout << "Usage: aie2ps_cpp_incremental <work dir>" << std::endl;
+    return 1;
+  }
+
+  std::filesystem::path dir(argv[1]);
+  std::filesystem::create_directories(dir);
+  auto weights = dir / "incremental_weights.bin";
+
+  try
+  {
+    write_pad(weights, 'a');
+    auto previous = assemble(source("0x00000080", 16), dir, {"incremental"});
+
+    if (!check("a column 1 BD edit", source("0x00000100", 16), dir, previous))
+      return 1;
+
+    write_pad(weights, 'b');
+    if (!check("a scratchpad content edit", source("0x00000100", 16), dir, previous))
+      return 1;
+
+    if (!check("a scratchpad size edit", source("0x00000100", 32), dir, previous))
+      return 1;
+
+    // back to the first input, every column was replaced in the cache
+    write_pad(weights, 'a');
+    if (!check("reverting all edits", source("0x00000080", 16), dir, previous))
+      return 1;
+  }
+  catch (aiebu::error &ex)
+  {
+    std::cout << "ERROR: " << ex.what() << ex.get_code() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
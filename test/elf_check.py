@@ -0,0 +1,392 @@
+#!/usr/bin/env python3
+
+# SPDX-License-Identifier: MIT
+# Copyright (C) 2025, Advanced Micro Devices, Inc. All rights reserved.
+
+# Structural checks of ELFs produced by aiebu-asm, used by the tests.
+# Only the python standard library is needed, the ELF is parsed by hand so
+# aiebu specific sections like .rela.packed can be decoded as well.
+# Exits with 1 and a message on the first failed check.
+
+import argparse
+import collections
+import struct
+import sys
+
+SHT_PROGBITS = 1
+SHT_HASH = 5
+SHT_AIEBU_PACKED_RELA = 0x80000001
+DT_NULL = 0
+DT_HASH = 4
+
+# aie2ps control code pages
+PAGE_SIZE = 8192
+PAGE_HEADER_SIZE = 16
+EOF_WORD = 0xFF
+PAD_WORD = 0xA5A5A5A5
+
+# symbol::patch_schema
+SCALER_32 = 3
+CONTROL_PACKET_48 = 4
+SHIM_DMA_48 = 5
+
+
+def fail(msg):
+    print("FAILED: " + msg)
+    sys.exit(1)
+
+
+def elf_hash(name):
+    h = 0
+    for c in name.encode():
+        h = ((h << 4) + c) & 0xFFFFFFFF
+        g = h & 0xF0000000
+        if g:
+            h ^= g >> 24
+        h &= ~g
+    return h
+
+
+def read_uleb(data, pos):
+    val = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        val |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return val, pos
+
+
+def read_sleb(data, pos):
+    val, end = read_uleb(data, pos)
+    bits = 7 * (end - pos)
+    if data[end - 1] & 0x40:
+        val -= 1 << bits
+    return val, end
+
+
+class Elf:
+    def __init__(self, path):
+        self.path = path
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            fail(path + " is not an ELF")
+        self.elfclass = 64 if self.data[4] == 2 else 32
+        self.endian = "<" if self.data[5] == 1 else ">"
+        if self.elfclass == 64:
+            ehdr = self.unpack("16sHHIQQQIHHHHHH", 0)
+        else:
+            ehdr = self.unpack("16sHHIIIIIHHHHHH", 0)
+        shoff, shentsize, shnum, shstrndx = ehdr[6], ehdr[11], ehdr[12], ehdr[13]
+
+        self.sections = []
+        for index in range(shnum):
+            if self.elfclass == 64:
+                shdr = self.unpack("IIQQQQIIQQ", shoff + index * shentsize)
+            else:
+                shdr = self.unpack("IIIIIIIIII", shoff + index * shentsize)
+            self.sections.append({"name": shdr[0], "type": shdr[1], "offset": shdr[4],
+                                  "size": shdr[5], "link": shdr[6], "entsize": shdr[9]})
+        strtab = self.sections[shstrndx]
+        for sec in self.sections:
+            sec["name"] = self.string(strtab, sec["name"])
+
+    def unpack(self, fmt, offset):
+        return struct.unpack_from(self.endian + fmt, self.data, offset)
+
+    def string(self, strtab, offset):
+        start = strtab["offset"] + offset
+        return self.data[start:self.data.index(b"\0", start)].decode()
+
+    def section(self, name):
+        for sec in self.sections:
+            if sec["name"] == name:
+                return sec
+        return None
+
+    def contents(self, sec):
+        return self.data[sec["offset"]:sec["offset"] + sec["size"]]
+
+    def symbols(self):
+        """name, size and section index of every .dynsym entry"""
+        dynsym = self.section(".dynsym")
+        if not dynsym:
+            return []
+        strtab = self.sections[dynsym["link"]]
+        syms = []
+        for offset in range(dynsym["offset"], dynsym["offset"] + dynsym["size"], dynsym["entsize"]):
+            if self.elfclass == 64:
+                name, _, _, shndx, _, size = self.unpack("IBBHQQ", offset)
+            else:
+                name, _, size, _, _, shndx = self.unpack("IIIBBH", offset)
+            syms.append({"name": self.string(strtab, name), "size": size, "shndx": shndx})
+        return syms
+
+    def dynamic(self):
+        """d_tag to d_val of .dynamic"""
+        dyn = self.section(".dynamic")
+        tags = {}
+        if not dyn:
+            return tags
+        entsize = 16 if self.elfclass == 64 else 8
+        for offset in range(dyn["offset"], dyn["offset"] + dyn["size"], entsize):
+            tag, val = self.unpack("qQ" if self.elfclass == 64 else "iI", offset)
+            if tag == DT_NULL:
+                break
+            tags[tag] = val
+        return tags
+
+    def relocations(self):
+        """(offset, symbol index, symbol name, schema, addend) from .rela.dyn or .rela.packed"""
+        names = [sym["name"] for sym in self.symbols()]
+        relocs = []
+        rela = self.section(".rela.dyn")
+        if rela:
+            for offset in range(rela["offset"], rela["offset"] + rela["size"], rela["entsize"]):
+                if self.elfclass == 64:
+                    r_offset, info, addend = self.unpack("QQq", offset)
+                    sym, schema = info >> 32, info & 0xFFFFFFFF
+                else:
+                    r_offset, info, addend = self.unpack("IIi", offset)
+                    sym, schema = info >> 8, info & 0xFF
+                relocs.append((r_offset, sym, names[sym], schema, addend))
+        packed = self.section(".rela.packed")
+        if packed:
+            if packed["type"] != SHT_AIEBU_PACKED_RELA:
+                fail(self.path + " .rela.packed has type " + hex(packed["type"]))
+            data = self.contents(packed)
+            groups, pos = read_uleb(data, 0)
+            for _ in range(groups):
+                sym, pos = read_uleb(data, pos)
+                schema, pos = read_uleb(data, pos)
+                addend, pos = read_sleb(data, pos)
+                count, pos = read_uleb(data, pos)
+                r_offset = 0
+                for _ in range(count):
+                    delta, pos = read_uleb(data, pos)
+                    r_offset += delta
+                    relocs.append((r_offset, sym, names[sym], schema, addend))
+            if pos != len(data):
+                fail(self.path + " .rela.packed has trailing bytes")
+        return sorted(relocs)
+
+
+def check_relocs(args):
+    elf = Elf(args.elf)
+    if args.packed and (not elf.section(".rela.packed") or elf.section(".rela.dyn")):
+        fail(args.elf + " has no .rela.packed in place of .rela.dyn")
+    relocs = elf.relocations()
+    reference = Elf(args.reference).relocations()
+    if not relocs or relocs != reference:
+        fail(args.elf + " relocations differ from " + args.reference)
+    print(args.elf + ": " + str(len(relocs)) + " relocations match " + args.reference)
+
+
+def check_hash(args):
+    elf = Elf(args.elf)
+    sec = elf.section(".hash")
+    if not sec or sec["type"] != SHT_HASH:
+        fail(args.elf + " has no SHT_HASH .hash section")
+    if elf.sections[sec["link"]]["name"] != ".dynsym":
+        fail(args.elf + " .hash is not linked to .dynsym")
+    if elf.dynamic().get(DT_HASH) != elf.sections.index(sec):
+        fail(args.elf + " .dynamic has no DT_HASH for .hash")
+
+    names = [sym["name"] for sym in elf.symbols()]
+    data = elf.contents(sec)
+    nbucket, nchain = struct.unpack_from(elf.endian + "II", data, 0)
+    if not nbucket or nchain != len(names) or len(data) != 4 * (2 + nbucket + nchain):
+        fail(args.elf + " .hash has nbucket " + str(nbucket) + " nchain " + str(nchain) +
+             " for " + str(len(names)) + " symbols")
+    table = struct.unpack_from(elf.endian + str(nbucket + nchain) + "I", data, 8)
+    bucket, chain = table[:nbucket], table[nbucket:]
+    # every symbol but the undefined one is found by a lookup of its name
+    for index, name in enumerate(names[1:], 1):
+        cur = bucket[elf_hash(name) % nbucket]
+        while cur and cur != index:
+            cur = chain[cur]
+        if not cur:
+            fail(args.elf + " symbol " + name + " is not found through .hash")
+    print(args.elf + ": .hash with " + str(nbucket) + " buckets covers " + str(nchain) + " symbols")
+
+
+def check_elf64(args):
+    elf = Elf(args.elf)
+    if elf.elfclass != 64:
+        fail(args.elf + " is not ELFCLASS64")
+    addends = [reloc[4] for reloc in elf.relocations()]
+    if args.addend not in addends:
+        fail(args.elf + " has no relocation with addend " + hex(args.addend))
+    print(args.elf + ": ELFCLASS64 with addend " + hex(args.addend))
+
+
+def patch(words, pos, schema, mask, address, addend):
+    """Patch 'address' into the words at byte offset 'pos' the way XRT does at run time"""
+    ddr_aie_addr_offset = 0x80000000
+    index = pos // 4
+    if schema == SCALER_32:
+        # the register value is used as is, 'mask' selects its bits
+        words[index] = (words[index] & ~mask & 0xFFFFFFFF) | (address & mask)
+    elif schema == SHIM_DMA_48:
+        base = ((words[index + 2] & 0xFFFF) << 32) | words[index + 1]
+        base += address + addend + ddr_aie_addr_offset
+        words[index + 1] = base & 0xFFFFFFFC
+        words[index + 2] = (words[index + 2] & 0xFFFF0000) | ((base >> 32) & 0xFFFF)
+    elif schema == CONTROL_PACKET_48:
+        base = ((words[index + 3] & 0xFFF) << 32) | words[index + 2]
+        base += address + addend + ddr_aie_addr_offset
+        words[index + 2] = base & 0xFFFFFFFC
+        words[index + 3] = (words[index + 3] & 0xFFFF0000) | ((base >> 32) & 0xFFFF)
+    else:
+        fail("schema " + str(schema) + " is not supported by the resolve check")
+
+
+def check_resolved(args):
+    elf = Elf(args.elf)
+    reference = Elf(args.reference)
+    resolved = {}
+    for item in args.resolve:
+        arg, address = item.split(":")
+        resolved[arg] = int(address, 0)
+
+    # the reference relocations of resolved args are applied to its sections
+    syms = reference.symbols()
+    sections = {}
+    for sec in reference.sections:
+        if sec["type"] == SHT_PROGBITS:
+            data = reference.contents(sec)
+            sections[sec["name"]] = list(struct.unpack_from(reference.endian + str(len(data) // 4) + "I", data))
+    expected = []
+    for r_offset, sym, name, schema, addend in reference.relocations():
+        if name not in resolved:
+            expected.append((r_offset, name, schema, addend))
+            continue
+        section = reference.sections[syms[sym]["shndx"]]["name"]
+        patch(sections[section], r_offset, schema, syms[sym]["size"], resolved[name], addend)
+
+    relocs = [(r_offset, name, schema, addend) for r_offset, _, name, schema, addend in elf.relocations()]
+    if sorted(relocs) != sorted(expected):
+        fail(args.elf + " relocations are not the ones of " + args.reference + " without the resolved args")
+    for name, words in sections.items():
+        sec = elf.section(name)
+        data = elf.contents(sec) if sec else b""
+        if data != struct.pack(elf.endian + str(len(words)) + "I", *words):
+            fail(args.elf + " " + name + " does not hold the resolved addresses")
+    print(args.elf + ": " + str(len(resolved)) + " args resolved, " + str(len(relocs)) + " relocations left")
+
+
+def column_pages(elf, col):
+    """page index to its .ctrltext.<col>.<page> and .ctrldata.<col>.<page> sections"""
+    pages = collections.defaultdict(dict)
+    for sec in elf.sections:
+        parts = sec["name"].split(".")
+        if len(parts) == 4 and parts[1] in ("ctrltext", "ctrldata") and parts[2] == str(col):
+            pages[int(parts[3])][parts[1]] = sec
+    return dict(sorted(pages.items()))
+
+
+def job_words(elf, col):
+    """words of the jobs of a column, page headers, EOF and padding dropped"""
+    words = collections.Counter()
+    for secs in column_pages(elf, col).values():
+        data = elf.contents(secs["ctrltext"])[PAGE_HEADER_SIZE:]
+        text = list(struct.unpack_from(elf.endian + str(len(data) // 4) + "I", data))
+        while text and text[-1] == PAD_WORD:
+            text.pop()
+        if not text or text.pop() != EOF_WORD:
+            fail(elf.path + " " + secs["ctrltext"]["name"] + " does not end with EOF")
+        words.update(text)
+    return words
+
+
+def check_pages(args):
+    elf = Elf(args.elf)
+    pages = column_pages(elf, args.col)
+    if list(pages) != list(range(args.count)):
+        fail(args.elf + " column " + str(args.col) + " has pages " + str(list(pages)) +
+             ", expected " + str(args.count))
+    for index, secs in pages.items():
+        if set(secs) != {"ctrltext", "ctrldata"}:
+            fail(args.elf + " page " + str(index) + " has no .ctrltext and .ctrldata pair")
+        text = elf.contents(secs["ctrltext"])
+        if text[:2] != b"\xff\xff" or struct.unpack_from("<H", text, 2)[0] != index:
+            fail(args.elf + " " + secs["ctrltext"]["name"] + " has no page header for page " + str(index))
+        if secs["ctrltext"]["size"] + secs["ctrldata"]["size"] > PAGE_SIZE:
+            fail(args.elf + " page " + str(index) + " is larger than " + str(PAGE_SIZE) + " bytes")
+    if args.reference and job_words(elf, args.col) != job_words(Elf(args.reference), args.col):
+        fail(args.elf + " jobs of column " + str(args.col) + " differ from " + args.reference)
+    print(args.elf + ": column " + str(args.col) + " in " + str(args.count) + " pages")
+
+
+def check_shared(args):
+    elf = Elf(args.elf)
+    pages = column_pages(elf, args.col)
+    original = column_pages(elf, args.original)
+    if not pages or list(pages) != list(original):
+        fail(args.elf + " columns " + str(args.col) + " and " + str(args.original) + " have different pages")
+    saved = 0
+    for index, secs in pages.items():
+        for kind, sec in secs.items():
+            org = original[index].get(kind)
+            if not org or (sec["offset"], sec["size"]) != (org["offset"], org["size"]):
+                fail(args.elf + " " + sec["name"] + " does not share the bytes of column " + str(args.original))
+            saved += sec["size"]
+    if args.reference:
+        reference = Elf(args.reference)
+        for sec in reference.sections:
+            if sec["type"] == SHT_PROGBITS and (not elf.section(sec["name"]) or
+                                               elf.contents(elf.section(sec["name"])) != reference.contents(sec)):
+                fail(args.elf + " " + sec["name"] + " differs from " + args.reference)
+        if len(elf.data) >= len(reference.data):
+            fail(args.elf + " is not smaller than " + args.reference)
+    print(args.elf + ": column " + str(args.col) + " shares " + str(saved) + " bytes of column " + str(args.original))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check the structure of an aiebu ELF")
+    sub = parser.add_subparsers(dest="check", required=True)
+
+    relocs = sub.add_parser("relocs", help="relocations are the same as the ones of a reference ELF")
+    relocs.add_argument("elf")
+    relocs.add_argument("reference")
+    relocs.add_argument("--packed", action="store_true", help="elf must use .rela.packed")
+    relocs.set_defaults(func=check_relocs)
+
+    hashsec = sub.add_parser("hash", help=".hash (DT_HASH) indexes every symbol of .dynsym")
+    hashsec.add_argument("elf")
+    hashsec.set_defaults(func=check_hash)
+
+    elf64 = sub.add_parser("elf64", help="ELFCLASS64 holding a relocation with the given addend")
+    elf64.add_argument("elf")
+    elf64.add_argument("--addend", type=lambda val: int(val, 0), required=True)
+    elf64.set_defaults(func=check_elf64)
+
+    resolved = sub.add_parser("resolved", help="args are patched in place of their relocations of a reference ELF")
+    resolved.add_argument("elf")
+    resolved.add_argument("reference")
+    resolved.add_argument("resolve", nargs="+", help="<arg>:<address>")
+    resolved.set_defaults(func=check_resolved)
+
+    pages = sub.add_parser("pages", help="aie2ps column is split into pages holding the jobs of a reference ELF")
+    pages.add_argument("elf")
+    pages.add_argument("--col", type=int, default=0)
+    pages.add_argument("--count", type=int, required=True, help="number of pages of the column")
+    pages.add_argument("--reference", help="ELF of the same asm paginated differently")
+    pages.set_defaults(func=check_pages)
+
+    shared = sub.add_parser("shared", help="aie2ps column pages point at the bytes of another column's pages")
+    shared.add_argument("elf")
+    shared.add_argument("--col", type=int, required=True)
+    shared.add_argument("--original", type=int, default=0, help="column whose pages hold the bytes")
+    shared.add_argument("--reference", help="ELF of the same asm built without sharing")
+    shared.set_defaults(func=check_shared)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()